@@ -221,272 +221,453 @@ namespace cxxblas {
 		}
 	}
 
-#if defined(LIBRAPID_HAS_OMP)
-
-	template<typename IndexType, typename ALPHA, typename MA, typename MB, typename BETA,
-			 typename MC>
-	void gemm_generic_parallel(StorageOrder order, Transpose transA, Transpose transB, IndexType m,
-							   IndexType n, IndexType k, const ALPHA &alpha, const MA *__restrict A,
-							   IndexType ldA, const MB *__restrict B, IndexType ldB,
-							   const BETA &beta, MC *__restrict C, IndexType ldC) {
-		CXXBLAS_DEBUG_OUT("gemm_generic_parallel");
-
-		[[maybe_unused]] auto threads = static_cast<int>(librapid::global::numThreads);
-
-		if ((m == 0) || (n == 0)) { return; }
-		if (order == ColMajor) {
-			gemm_generic_parallel(
-			  RowMajor, transB, transA, n, m, k, alpha, B, ldB, A, ldA, beta, C, ldC);
-			return;
-		}
-
-		gescal_init(order, m, n, beta, C, ldC);
-		if (alpha == ALPHA(0)) { return; }
-		if ((transA == NoTrans) && (transB == NoTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, NoTrans, m, k, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == NoTrans) && (transB == Conj)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				// Single threaded for small n
-				gemv(order, NoTrans, Conj, m, k, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == NoTrans) && (transB == Trans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 NoTrans,
-					 m,
-					 k,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
-			}
-		}
-		if ((transA == NoTrans) && (transB == ConjTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 NoTrans,
-					 Conj,
-					 m,
-					 k,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
+	/// Register and cache blocking parameters for gemm_packed. The micro-kernel keeps an
+	/// MR x NR tile of C in registers, while a KC x NR panel of packed B stays in the L1 cache,
+	/// an MC x KC block of packed A in the L2 cache, and a KC x NC block of packed B in the L3
+	/// cache.
+	template<typename T>
+	struct GemmBlocking {
+		using Info = librapid::typetraits::TypeInfo<T>;
+
+		/// True if the micro-kernel operates on SIMD packets. Every other type uses a scalar
+		/// micro-kernel with the same structure
+		static constexpr bool vectorise = Info::allowVectorisation && Info::packetWidth > 1;
+		static constexpr int64_t packetWidth = vectorise ? Info::packetWidth : 1;
+
+		static constexpr int64_t MR = vectorise ? 6 : 4;
+		static constexpr int64_t NR = vectorise ? 2 * packetWidth : 4;
+		static constexpr int64_t KC = 256;
+		static constexpr int64_t MC = 120;
+		static constexpr int64_t NC = 4096;
+
+		static_assert(MC % MR == 0 && NC % NR == 0, "Block sizes must be multiples of tiles");
+	};
+
+	/// Pack an mc x kc block of a row-major matrix into panels of MR rows. Within a panel,
+	/// the MR elements of each column are stored next to each other, and the rows past the
+	/// edge of the matrix are filled with zeros.
+	/// \param mc Rows in the block
+	/// \param kc Columns in the block
+	/// \param A Pointer to the first element of the block
+	/// \param rowStride Distance between consecutive rows of the block
+	/// \param colStride Distance between consecutive columns of the block
+	/// \param packed Output buffer, with space for ceil(mc / MR) * MR * kc elements
+	template<typename T>
+	void gemm_pack_a(int64_t mc, int64_t kc, const T *A, int64_t rowStride, int64_t colStride,
+					 T *packed) {
+		constexpr int64_t MR = GemmBlocking<T>::MR;
+
+		for (int64_t ir = 0; ir < mc; ir += MR) {
+			const int64_t mr = std::min(MR, mc - ir);
+			const T *panel	 = A + ir * rowStride;
+
+			for (int64_t p = 0; p < kc; ++p) {
+				int64_t i = 0;
+				for (; i < mr; ++i) packed[i] = panel[i * rowStride + p * colStride];
+				for (; i < MR; ++i) packed[i] = T(0);
+				packed += MR;
 			}
 		}
+	}
 
-		if ((transA == Conj) && (transB == NoTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, NoTrans, m, k, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == Conj) && (transB == Conj)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, Conj, Conj, m, k, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == Conj) && (transB == Trans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(
-				  order, Conj, m, k, alpha, A, ldA, B + l * ldB, IndexType(1), BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == Conj) && (transB == ConjTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 Conj,
-					 Conj,
-					 m,
-					 k,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
+	/// Pack a kc x nc block of a row-major matrix into panels of NR columns. Within a panel,
+	/// the NR elements of each row are stored next to each other, and the columns past the
+	/// edge of the matrix are filled with zeros.
+	/// \param kc Rows in the block
+	/// \param nc Columns in the block
+	/// \param B Pointer to the first element of the block
+	/// \param rowStride Distance between consecutive rows of the block
+	/// \param colStride Distance between consecutive columns of the block
+	/// \param packed Output buffer, with space for ceil(nc / NR) * NR * kc elements
+	template<typename T>
+	void gemm_pack_b(int64_t kc, int64_t nc, const T *B, int64_t rowStride, int64_t colStride,
+					 T *packed) {
+		constexpr int64_t NR = GemmBlocking<T>::NR;
+
+		for (int64_t jr = 0; jr < nc; jr += NR) {
+			const int64_t nr = std::min(NR, nc - jr);
+			const T *panel	 = B + jr * colStride;
+
+			for (int64_t p = 0; p < kc; ++p) {
+				const T *row = panel + p * rowStride;
+				int64_t j	 = 0;
+				for (; j < nr; ++j) packed[j] = row[j * colStride];
+				for (; j < NR; ++j) packed[j] = T(0);
+				packed += NR;
 			}
 		}
+	}
 
-		if ((transA == Trans) && (transB == NoTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, Trans, k, m, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == Trans) && (transB == Conj)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, Trans, Conj, k, m, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == Trans) && (transB == Trans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 Trans,
-					 k,
-					 m,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
-			}
-		}
-		if ((transA == Trans) && (transB == ConjTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 Trans,
-					 Conj,
-					 k,
-					 m,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
+	/// Compute C = alpha * A * B + beta * C for an mr x nr tile of C, where A is a packed
+	/// MR x kc panel and B is a packed kc x NR panel. If beta is zero, C is not read.
+	/// \param kc Length of the inner dimension
+	/// \param A Packed panel of A (see gemm_pack_a)
+	/// \param B Packed panel of B (see gemm_pack_b)
+	/// \param alpha Scaling factor for A * B
+	/// \param beta Scaling factor for C
+	/// \param C Pointer to the first element of the tile of C
+	/// \param ldC Leading dimension of C
+	/// \param mr Rows of the tile (at most MR)
+	/// \param nr Columns of the tile (at most NR)
+	template<typename T>
+	void gemm_micro_kernel(int64_t kc, const T *__restrict A, const T *__restrict B,
+						   const T &alpha, const T &beta, T *C, int64_t ldC, int64_t mr,
+						   int64_t nr) {
+		using Blocking		 = GemmBlocking<T>;
+		constexpr int64_t MR = Blocking::MR;
+		constexpr int64_t NR = Blocking::NR;
+
+		if constexpr (Blocking::vectorise) {
+			using Packet		  = typename librapid::typetraits::TypeInfo<T>::Packet;
+			constexpr int64_t W	  = Blocking::packetWidth;
+			constexpr int64_t NP  = NR / W;
+			Packet acc[MR][NP];
+
+			for (int64_t i = 0; i < MR; ++i) {
+				for (int64_t j = 0; j < NP; ++j) acc[i][j] = Packet(T(0));
+			}
+
+			for (int64_t p = 0; p < kc; ++p) {
+				Packet b[NP];
+				for (int64_t j = 0; j < NP; ++j) b[j] = xsimd::load_unaligned(B + j * W);
+
+				for (int64_t i = 0; i < MR; ++i) {
+					const Packet a(A[i]);
+					for (int64_t j = 0; j < NP; ++j) acc[i][j] = xsimd::fma(a, b[j], acc[i][j]);
+				}
+
+				A += MR;
+				B += NR;
+			}
+
+			const Packet alphaPacket(alpha);
+			const Packet betaPacket(beta);
+			const bool betaZero = beta == T(0);
+
+			if (mr == MR && nr == NR) {
+				for (int64_t i = 0; i < MR; ++i) {
+					for (int64_t j = 0; j < NP; ++j) {
+						T *c = C + i * ldC + j * W;
+						if (betaZero) {
+							(alphaPacket * acc[i][j]).store_unaligned(c);
+						} else {
+							const Packet old = betaPacket * xsimd::load_unaligned(c);
+							xsimd::fma(alphaPacket, acc[i][j], old).store_unaligned(c);
+						}
+					}
+				}
+				return;
+			}
+
+			// A tile on the edge of C
+			T tile[MR * NR];
+			for (int64_t i = 0; i < MR; ++i) {
+				for (int64_t j = 0; j < NP; ++j) acc[i][j].store_unaligned(tile + i * NR + j * W);
+			}
+
+			for (int64_t i = 0; i < mr; ++i) {
+				for (int64_t j = 0; j < nr; ++j) {
+					const T product = alpha * tile[i * NR + j];
+					T &c			= C[i * ldC + j];
+					c				= betaZero ? product : product + beta * c;
+				}
+			}
+		} else {
+			T acc[MR][NR];
+			for (int64_t i = 0; i < MR; ++i) {
+				for (int64_t j = 0; j < NR; ++j) acc[i][j] = T(0);
+			}
+
+			for (int64_t p = 0; p < kc; ++p) {
+				for (int64_t i = 0; i < MR; ++i) {
+					for (int64_t j = 0; j < NR; ++j) acc[i][j] += A[i] * B[j];
+				}
+
+				A += MR;
+				B += NR;
+			}
+
+			const bool betaZero = beta == T(0);
+			for (int64_t i = 0; i < mr; ++i) {
+				for (int64_t j = 0; j < nr; ++j) {
+					T &c = C[i * ldC + j];
+					c	 = betaZero ? alpha * acc[i][j] : alpha * acc[i][j] + beta * c;
+				}
 			}
 		}
+	}
 
-		if ((transA == ConjTrans) && (transB == NoTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, ConjTrans, k, m, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == ConjTrans) && (transB == Conj)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order, ConjTrans, k, m, alpha, A, ldA, B + l, ldB, BETA(1), C + l, ldC);
-			}
-		}
-		if ((transA == ConjTrans) && (transB == Trans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 ConjTrans,
-					 k,
-					 m,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
-			}
-		}
-		if ((transA == ConjTrans) && (transB == ConjTrans)) {
-#pragma omp parallel for shared(                                                                   \
-  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC) default(none)               \
-  num_threads(threads)
-			for (IndexType l = 0; l < n; ++l) {
-				gemv(order,
-					 ConjTrans,
-					 Conj,
-					 k,
-					 m,
-					 alpha,
-					 A,
-					 ldA,
-					 B + l * ldB,
-					 IndexType(1),
-					 BETA(1),
-					 C + l,
-					 ldC);
+	/// The tile epilogue used by default, which leaves C unchanged (see gemm_packed)
+	struct GemmNoEpilogue {
+		template<typename T>
+		void operator()(T *, int64_t, int64_t, int64_t, int64_t, int64_t) const {}
+	};
+
+	/// Returns true if a product with \p n columns should be distributed over LibRapid's thread
+	/// pool. Calls from inside a parallel region would run serially anyway
+	template<typename IndexType>
+	bool gemm_multithread(IndexType n) {
+		return n >= librapid::global::gemmMultithreadThreshold &&
+			   librapid::global::numThreads > 1 &&
+			   !librapid::detail::ThreadPool::inParallelRegion();
+	}
+
+	/// \brief Packed, cache-blocked matrix-matrix multiplication
+	///
+	/// Computes C = alpha * op(A) * op(B) + beta * C for row-major matrices, following the
+	/// structure of BLIS. Blocks of op(A) and op(B) are copied into contiguous buffers (see
+	/// gemm_pack_a and gemm_pack_b), and C is updated one MR x NR tile at a time by
+	/// gemm_micro_kernel. If \p multiThread is true, blocks of C are distributed over LibRapid's
+	/// thread pool.
+	///
+	/// Once the final block of the inner dimension has been accumulated into a tile, the tile is
+	/// passed to \p epilogue as `epilogue(tile, ldC, row, col, rows, cols)`, on the thread
+	/// which computed it and while it is still in the L1 cache. row and col give the position
+	/// of the tile in C, and rows and cols its size.
+	///
+	/// This works for any scalar type. Types which support SIMD packets use a vectorised
+	/// micro-kernel.
+	template<typename IndexType, typename T, typename Epilogue = GemmNoEpilogue>
+	void gemm_packed(Transpose transA, Transpose transB, IndexType m, IndexType n, IndexType k,
+					 const T &alpha, const T *A, IndexType ldA, const T *B, IndexType ldB,
+					 const T &beta, T *C, IndexType ldC, bool multiThread,
+					 const Epilogue &epilogue = Epilogue()) {
+		CXXBLAS_DEBUG_OUT("gemm_packed");
+
+		using Blocking		 = GemmBlocking<T>;
+		constexpr int64_t MR = Blocking::MR;
+		constexpr int64_t NR = Blocking::NR;
+		constexpr int64_t KC = Blocking::KC;
+		constexpr int64_t MC = Blocking::MC;
+		constexpr int64_t NC = Blocking::NC;
+		auto roundUp		 = [](int64_t x, int64_t multiple) {
+			return (x + multiple - 1) / multiple * multiple;
+		};
+
+		const auto rows = static_cast<int64_t>(m);
+		const auto cols = static_cast<int64_t>(n);
+		const auto deep = static_cast<int64_t>(k);
+		const auto ldc	= static_cast<int64_t>(ldC);
+
+		// Element (i, p) of op(A) is A[i * aRow + p * aCol], and element (p, j) of op(B) is
+		// B[p * bRow + j * bCol]
+		const int64_t aRow = transA == NoTrans ? static_cast<int64_t>(ldA) : 1;
+		const int64_t aCol = transA == NoTrans ? 1 : static_cast<int64_t>(ldA);
+		const int64_t bRow = transB == NoTrans ? static_cast<int64_t>(ldB) : 1;
+		const int64_t bCol = transB == NoTrans ? 1 : static_cast<int64_t>(ldB);
+
+		const int64_t panelsB = (std::min(cols, NC) + NR - 1) / NR;
+		std::vector<T> packedB(panelsB * NR * std::min(deep, KC));
+
+		// C is divided into tasks of (at most) MC rows by a group of NR-column panels. With
+		// several threads, the blocks are made smaller until there are enough tasks to keep
+		// every thread busy
+		const int64_t threads =
+		  multiThread ? static_cast<int64_t>(librapid::global::numThreads) : int64_t(1);
+		const int64_t mc		= std::clamp(roundUp((rows + threads - 1) / threads, MR), MR, MC);
+		const int64_t rowBlocks = (rows + mc - 1) / mc;
+		const int64_t colGroups =
+		  std::clamp((threads + rowBlocks - 1) / rowBlocks, int64_t(1), panelsB);
+
+		for (int64_t jc = 0; jc < cols; jc += NC) {
+			const int64_t nc		  = std::min(NC, cols - jc);
+			const int64_t panels	  = (nc + NR - 1) / NR;
+			const int64_t groupPanels = (panels + colGroups - 1) / colGroups;
+
+			for (int64_t pc = 0; pc < deep; pc += KC) {
+				const int64_t kc  = std::min(KC, deep - pc);
+				const T *blockB	  = B + pc * bRow + jc * bCol;
+				const T blockBeta = pc == 0 ? beta : T(1);
+				const bool lastKc = pc + kc == deep;
+
+				auto packPanels = [&](int64_t first, int64_t last) {
+					gemm_pack_b(kc,
+								std::min(nc, last * NR) - first * NR,
+								blockB + first * NR * bCol,
+								bRow,
+								bCol,
+								packedB.data() + first * NR * kc);
+				};
+
+				auto multiplyTasks = [&](int64_t first, int64_t last) {
+					// Each thread packs blocks of A into its own buffer, which is kept between
+					// calls. Consecutive tasks in the same row block reuse the packed block
+					thread_local std::vector<T> packedA;
+					if (packedA.size() < static_cast<size_t>(roundUp(mc, MR) * kc)) {
+						packedA.resize(roundUp(mc, MR) * kc);
+					}
+					int64_t packedBlock = -1;
+
+					for (int64_t task = first; task < last; ++task) {
+						const int64_t block		= task / colGroups;
+						const int64_t ic		= block * mc;
+						const int64_t blockRows = std::min(mc, rows - ic);
+						const int64_t jrBegin	= (task % colGroups) * groupPanels * NR;
+						const int64_t jrEnd		= std::min(nc, jrBegin + groupPanels * NR);
+
+						if (block != packedBlock) {
+							gemm_pack_a(
+							  blockRows, kc, A + ic * aRow + pc * aCol, aRow, aCol, packedA.data());
+							packedBlock = block;
+						}
+
+						for (int64_t jr = jrBegin; jr < jrEnd; jr += NR) {
+							const int64_t nr = std::min(NR, nc - jr);
+							for (int64_t ir = 0; ir < blockRows; ir += MR) {
+								const int64_t mr = std::min(MR, blockRows - ir);
+								T *tile			 = C + (ic + ir) * ldc + jc + jr;
+								gemm_micro_kernel(kc,
+												  packedA.data() + ir * kc,
+												  packedB.data() + jr * kc,
+												  alpha,
+												  blockBeta,
+												  tile,
+												  ldc,
+												  mr,
+												  nr);
+
+								if constexpr (!std::is_same_v<Epilogue, GemmNoEpilogue>) {
+									if (lastKc) epilogue(tile, ldc, ic + ir, jc + jr, mr, nr);
+								}
+							}
+						}
+					}
+				};
+
+				if (multiThread) {
+					librapid::parallelFor(0, panels, packPanels);
+					librapid::parallelFor(0, rowBlocks * colGroups, multiplyTasks);
+				} else {
+					packPanels(0, panels);
+					multiplyTasks(0, rowBlocks * colGroups);
+				}
 			}
 		}
 	}
 
-#endif // LIBRAPID_HAS_OMP
-
 	template<typename IndexType, typename ALPHA, typename MA, typename MB, typename BETA,
 			 typename MC>
 	void gemm(StorageOrder order, Transpose transA, Transpose transB, IndexType m, IndexType n,
 			  IndexType k, const ALPHA &alpha, const MA *A, IndexType ldA, const MB *B,
 			  IndexType ldB, const BETA &beta, MC *C, IndexType ldC) {
-		// Determine whether to use a multithreaded version
-#if defined(LIBRAPID_HAS_OMP)
-		bool multiThread = true;
-		if (n < librapid::global::gemmMultithreadThreshold) multiThread = false;
-		if (librapid::global::numThreads < 2) multiThread = false;
-#else
-		constexpr bool multiThread = false;
-#endif
-
-#if defined(LIBRAPID_HAS_OMP)
-		if (multiThread) {
-			gemm_generic_parallel(
-			  order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
-		} else 
-#endif // LIBRAPID_HAS_OMP
-		{
-			gemm_generic(order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
-		}
+		constexpr bool packable = std::is_same_v<MA, MC> && std::is_same_v<MB, MC> &&
+								  std::is_convertible_v<ALPHA, MC> &&
+								  std::is_convertible_v<BETA, MC>;
+
+		// The packed kernel does not support conjugation
+		const bool plain = (transA == NoTrans || transA == Trans) &&
+						   (transB == NoTrans || transB == Trans);
+
+		if constexpr (packable) {
+			if (plain) {
+				if ((m == 0) || (n == 0)) { return; }
+				if (order == ColMajor) {
+					gemm(RowMajor, transB, transA, n, m, k, alpha, B, ldB, A, ldA, beta, C, ldC);
+					return;
+				}
+
+				if (k == 0 || alpha == ALPHA(0)) {
+					gescal_init(order, m, n, beta, C, ldC);
+					return;
+				}
+
+				gemm_packed(transA,
+							transB,
+							m,
+							n,
+							k,
+							static_cast<MC>(alpha),
+							A,
+							ldA,
+							B,
+							ldB,
+							static_cast<MC>(beta),
+							C,
+							ldC,
+							gemm_multithread(n));
+				return;
+			}
+		}
+
+		gemm_generic(order, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
 	}
 
+	/// \brief Matrix-matrix multiplication with a fused epilogue
+	///
+	/// Computes C = alpha * op(A) * op(B) + beta * C for row-major matrices, and passes each
+	/// tile of C to \p epilogue as soon as it is final (see gemm_packed). The product is always
+	/// computed by gemm_packed where possible, even for types which gemm would pass to BLAS.
+	/// Otherwise, the whole of C is passed to \p epilogue as a single tile once it has been
+	/// computed.
+	template<typename IndexType, typename ALPHA, typename MA, typename MB, typename BETA,
+			 typename MC, typename Epilogue>
+	void gemm_fused(Transpose transA, Transpose transB, IndexType m, IndexType n, IndexType k,
+					const ALPHA &alpha, const MA *A, IndexType ldA, const MB *B, IndexType ldB,
+					const BETA &beta, MC *C, IndexType ldC, const Epilogue &epilogue) {
+		CXXBLAS_DEBUG_OUT("gemm_fused");
+
+		constexpr bool packable = std::is_same_v<MA, MC> && std::is_same_v<MB, MC> &&
+								  std::is_convertible_v<ALPHA, MC> &&
+								  std::is_convertible_v<BETA, MC>;
+
+		const bool plain = (transA == NoTrans || transA == Trans) &&
+						   (transB == NoTrans || transB == Trans);
+
+		if ((m == 0) || (n == 0)) { return; }
+		const auto rows = static_cast<int64_t>(m);
+		const auto cols = static_cast<int64_t>(n);
+		const auto ldc	= static_cast<int64_t>(ldC);
+
+		if constexpr (packable) {
+			if (plain) {
+				if (k == 0 || alpha == ALPHA(0)) {
+					gescal_init(RowMajor, m, n, beta, C, ldC);
+					epilogue(C, ldc, int64_t(0), int64_t(0), rows, cols);
+					return;
+				}
+
+				gemm_packed(transA,
+							transB,
+							m,
+							n,
+							k,
+							static_cast<MC>(alpha),
+							A,
+							ldA,
+							B,
+							ldB,
+							static_cast<MC>(beta),
+							C,
+							ldC,
+							gemm_multithread(n),
+							epilogue);
+				return;
+			}
+		}
+
+		gemm_generic(RowMajor, transA, transB, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
+		epilogue(C, ldc, int64_t(0), int64_t(0), rows, cols);
+	}
+
+	/// Evaluates to true if gemm multiplies matrices of \p T with BLAS rather than with
+	/// gemm_packed
+	template<typename T>
+	struct GemmUsesBlas : std::false_type {};
+
 #ifdef HAVE_CBLAS
 
+	template<>
+	struct GemmUsesBlas<float> : std::true_type {};
+
+	template<>
+	struct GemmUsesBlas<double> : std::true_type {};
+
+	template<>
+	struct GemmUsesBlas<ComplexFloat> : std::true_type {};
+
+	template<>
+	struct GemmUsesBlas<ComplexDouble> : std::true_type {};
+
 	// sgemm
 	template<typename IndexType>
 	typename If<IndexType>::isBlasCompatibleInteger
@@ -17,14 +17,19 @@
 #include "commaInitializer.hpp"
 #include "arrayIterator.hpp"
 #include "arrayContainer.hpp"
+#include "broadcast.hpp"
 #include "operations.hpp"
 #include "function.hpp"
+#include "parallelThreshold.hpp"
 #include "assignOps.hpp"
+#include "assignMany.hpp"
 #include "generalArrayView.hpp"
 #include "generalArrayViewToString.hpp"
 #include "arrayFromData.hpp"
 #include "fill.hpp"
 #include "pseudoConstructors.hpp"
+#include "reductions.hpp"
+#include "scans.hpp"
 #include "fourierTransform.hpp"
 
 #include "linalg/linalg.hpp"
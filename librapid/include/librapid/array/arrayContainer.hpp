@@ -141,13 +141,13 @@ namespace librapid {
 			/// \param shape The shape of the array container
 			LIBRAPID_ALWAYS_INLINE explicit ArrayContainer(ShapeType &&shape);
 
-			/// \brief Reference an existing array container
+			/// \brief Share the data of an existing array container
 			///
-			/// This constructor does not copy the data, but instead references the data of the
-			/// input array container. This means that the input array container must outlive the
-			/// constructed array container. Please use ``ArrayContainer::copy()`` if you want to
-			/// copy the data.
-			/// \param other The array container to reference
+			/// This constructor does not copy the data up front. For CPU arrays, the two array
+			/// containers share their elements until one of them is modified, at which point it
+			/// makes a copy of its own. Please use ``ArrayContainer::copy()`` if you want to copy
+			/// the data immediately.
+			/// \param other The array container to share
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ArrayContainer &other) = default;
 
 			/// Construct an array container from a temporary array container.
@@ -158,10 +158,15 @@ namespace librapid {
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(const Transpose<TransposeType> &trans);
 
 			template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-					 typename StorageTypeB, typename Alpha, typename Beta>
+					 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 			LIBRAPID_ALWAYS_INLINE
 			ArrayContainer(const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB,
-													   StorageTypeB, Alpha, Beta> &multiply);
+													   StorageTypeB, Alpha, Beta, TransA,
+													   TransB> &multiply);
+
+			template<typename Multiply, typename Epilogue>
+			LIBRAPID_ALWAYS_INLINE
+			ArrayContainer(const linalg::FusedArrayMultiply<Multiply, Epilogue> &multiply);
 
 			template<typename desc, typename Functor_, typename... Args>
 			LIBRAPID_ALWAYS_INLINE ArrayContainer &
@@ -177,14 +182,13 @@ namespace librapid {
 			LIBRAPID_ALWAYS_INLINE
 			ArrayContainer(const detail::Function<desc, Functor_, Args...> &function);
 
-			/// \brief Reference an existing array container
+			/// \brief Share the data of an existing array container
 			///
-			/// This assignment operator does not copy the data, but instead references the data of
-			/// the input array container. This means that the input array container must outlive
-			/// the constructed array container. Please use ``ArrayContainer::copy()`` if you want
-			/// to copy the data.
+			/// As with the copy constructor, the data is not copied up front. CPU arrays share
+			/// their elements until one of the array containers is modified. Please use
+			/// ``ArrayContainer::copy()`` if you want to copy the data immediately.
 			///
-			/// \param other The array container to reference
+			/// \param other The array container to share
 			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator=(const ArrayContainer &other) = default;
 
 			template<typename ArrayViewType, typename ArrayViewScalar>
@@ -214,10 +218,15 @@ namespace librapid {
 			operator=(const Transpose<TransposeType> &transpose);
 
 			template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-					 typename StorageTypeB, typename Alpha, typename Beta>
+					 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 			LIBRAPID_ALWAYS_INLINE ArrayContainer &
 			operator=(const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB,
-												  StorageTypeB, Alpha, Beta> &multiply);
+												  StorageTypeB, Alpha, Beta, TransA,
+												  TransB> &multiply);
+
+			template<typename Multiply, typename Epilogue>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &
+			operator=(const linalg::FusedArrayMultiply<Multiply, Epilogue> &multiply);
 
 			/// Allow ArrayContainer objects to be initialized with a comma separated list of
 			/// values. This makes use of the CommaInitializer class
@@ -240,6 +249,14 @@ namespace librapid {
 			/// \see ArrayView
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index) const;
 
+			/// Access a sub-array of this ArrayContainer instance. The sub-array is a lightweight
+			/// ArrayView which references the same memory as this ArrayContainer instance, so
+			/// creating it never allocates or copies anything. Assigning to the result writes to
+			/// this array, and copies of the result are views too. Expressions involving it are
+			/// still evaluated in packets, since each row of the view is contiguous.
+			/// \param index The index of the sub-array
+			/// \return A reference to the sub-array (ArrayView)
+			/// \see ArrayView
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index);
 
 			template<typename... Indices>
@@ -351,6 +368,14 @@ namespace librapid {
 					 const char (&formatString)[N], Ctx &ctx) const;
 
 		private:
+			/// Resize the storage to hold \p size elements, which are about to be overwritten
+			/// with the result of evaluating \p source. Elements shared with a copy of this
+			/// array are only copied first if \p source reads them.
+			/// \param source The object which will be evaluated into this array
+			/// \param size The number of elements in the result
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE void resizeToEvaluate(const T &source, size_t size);
+
 			ShapeType m_shape;	   // The shape type of the array
 			size_t m_size;		   // The size of the array
 			StorageType m_storage; // The storage container of the array
@@ -476,10 +501,17 @@ namespace librapid {
 
 		template<typename ShapeType_, typename StorageType_>
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 		LIBRAPID_ALWAYS_INLINE ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(
 		  const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-									  Beta> &multiply) {
+									  Beta, TransA, TransB> &multiply) {
+			*this = multiply;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename Multiply, typename Epilogue>
+		LIBRAPID_ALWAYS_INLINE ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(
+		  const linalg::FusedArrayMultiply<Multiply, Epilogue> &multiply) {
 			*this = multiply;
 		}
 
@@ -488,13 +520,14 @@ namespace librapid {
 		LIBRAPID_ALWAYS_INLINE auto ArrayContainer<ShapeType_, StorageType_>::assign(
 		  const detail::Function<desc, Functor_, Args...> &function) -> ArrayContainer & {
 			using FunctionType = detail::Function<desc, Functor_, Args...>;
-			m_storage.resize(function.size(), 0);
+			resizeToEvaluate(function, function.size());
 			if constexpr (std::is_same_v<typename FunctionType::Backend, backend::OpenCL> ||
 						  std::is_same_v<typename FunctionType::Backend, backend::CUDA>) {
 				detail::assign(*this, function);
 			} else {
 #if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (m_storage.size() > global::multithreadThreshold && global::numThreads > 1)
+				if (global::numThreads > 1 &&
+					m_storage.size() > detail::parallelThreshold(function))
 					detail::assignParallel(*this, function);
 				else
 #endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
@@ -532,10 +565,10 @@ namespace librapid {
 
 		template<typename ShapeType_, typename StorageType_>
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 		LIBRAPID_ALWAYS_INLINE auto ArrayContainer<ShapeType_, StorageType_>::operator=(
 		  const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-									  Beta> &arrayMultiply) -> ArrayContainer & {
+									  Beta, TransA, TransB> &arrayMultiply) -> ArrayContainer & {
 			m_shape = arrayMultiply.shape();
 			m_size	= arrayMultiply.size();
 			m_storage.resize(m_shape.size(), 0);
@@ -543,14 +576,30 @@ namespace librapid {
 			return *this;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		template<typename Multiply, typename Epilogue>
+		LIBRAPID_ALWAYS_INLINE auto ArrayContainer<ShapeType_, StorageType_>::operator=(
+		  const linalg::FusedArrayMultiply<Multiply, Epilogue> &multiply) -> ArrayContainer & {
+			m_shape = multiply.shape();
+			m_size	= multiply.size();
+			m_storage.resize(m_shape.size(), 0);
+			multiply.applyTo(*this);
+			return *this;
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		template<typename ArrayViewType, typename ArrayViewScalar>
 		LIBRAPID_ALWAYS_INLINE auto ArrayContainer<ShapeType_, StorageType_>::operator=(
 		  const array::GeneralArrayView<ArrayViewType, ArrayViewScalar> &view) -> ArrayContainer & {
 			m_shape = view.shape();
 			m_size	= view.size();
-			m_storage.resize(m_shape.size(), 0);
-			for (int64_t i = 0; i < m_size; ++i) { m_storage[i] = view.scalar(i); }
+			resizeToEvaluate(view, m_shape.size());
+
+			if constexpr (std::is_same_v<StorageType_, Storage<Scalar>>) {
+				detail::assign(*this, view);
+			} else {
+				for (int64_t i = 0; i < m_size; ++i) { m_storage[i] = view.scalar(i); }
+			}
 			return *this;
 		}
 
@@ -593,41 +642,6 @@ namespace librapid {
 			  m_shape[0]);
 
 			return createGeneralArrayView(*this)[index];
-
-			//			if constexpr (typetraits::IsOpenCLStorage<StorageType_>::value) {
-			// #if defined(LIBRAPID_HAS_OPENCL)
-			//				ArrayContainer res;
-			//				res.m_shape			= m_shape.subshape(1, ndim());
-			//				auto subSize		= res.shape().size();
-			//				int64_t storageSize = sizeof(typename StorageType_::Scalar);
-			//				cl_buffer_region region {index * subSize * storageSize, subSize *
-			// storageSize}; 				res.m_storage =
-			// StorageType_(m_storage.data().createSubBuffer(
-			// StorageType_::bufferFlags,
-			// CL_BUFFER_CREATE_TYPE_REGION, &region), 							   subSize,
-			// false); 				return res; #else 				LIBRAPID_ERROR("OpenCL support
-			// not enabled"); #endif // LIBRAPID_HAS_OPENCL 			} else if constexpr
-			//(typetraits::IsCudaStorage<StorageType_>::value) { #if defined(LIBRAPID_HAS_CUDA)
-			//				ArrayContainer res;
-			//				res.m_shape	  = m_shape.subshape(1, ndim());
-			//				auto subSize  = res.shape().size();
-			//				Scalar *begin = m_storage.begin().get() + index * subSize;
-			//				res.m_storage = StorageType_(begin, subSize, false);
-			//				return res;
-			// #else
-			//				LIBRAPID_ERROR("CUDA support not enabled");
-			// #endif // LIBRAPID_HAS_CUDA
-			//			} else if constexpr (typetraits::IsFixedStorage<StorageType_>::value) {
-			//				return GeneralArrayView(*this)[index];
-			//			} else {
-			//				ArrayContainer res;
-			//				res.m_shape	  = m_shape.subshape(1, ndim());
-			//				auto subSize  = res.shape().size();
-			//				Scalar *begin = m_storage.begin() + index * subSize;
-			//				Scalar *end	  = begin + subSize;
-			//				res.m_storage = StorageType_(begin, end, false);
-			//				return res;
-			//			}
 		}
 
 		template<typename ShapeType_, typename StorageType_>
@@ -641,41 +655,6 @@ namespace librapid {
 			  m_shape[0]);
 
 			return createGeneralArrayView(*this)[index];
-
-			//			if constexpr (typetraits::IsOpenCLStorage<StorageType_>::value) {
-			// #if defined(LIBRAPID_HAS_OPENCL)
-			//				ArrayContainer res;
-			//				res.m_shape			= m_shape.subshape(1, ndim());
-			//				auto subSize		= res.shape().size();
-			//				int64_t storageSize = sizeof(typename StorageType_::Scalar);
-			//				cl_buffer_region region {index * subSize * storageSize, subSize *
-			// storageSize}; 				res.m_storage =
-			// StorageType_(m_storage.data().createSubBuffer(
-			// StorageType_::bufferFlags,
-			// CL_BUFFER_CREATE_TYPE_REGION, &region), 							   subSize,
-			// false); 				return res; #else 				LIBRAPID_ERROR("OpenCL support
-			// not enabled"); #endif // LIBRAPID_HAS_OPENCL 			} else if constexpr
-			//(typetraits::IsCudaStorage<StorageType_>::value) { #if defined(LIBRAPID_HAS_CUDA)
-			//				ArrayContainer res;
-			//				res.m_shape	  = m_shape.subshape(1, ndim());
-			//				auto subSize  = res.shape().size();
-			//				Scalar *begin = m_storage.begin().get() + index * subSize;
-			//				res.m_storage = StorageType_(begin, subSize, false);
-			//				return res;
-			// #else
-			//				LIBRAPID_ERROR("CUDA support not enabled");
-			// #endif // LIBRAPID_HAS_CUDA
-			//			} else if constexpr (typetraits::IsFixedStorage<StorageType_>::value) {
-			//				return GeneralArrayView(*this)[index];
-			//			} else {
-			//				ArrayContainer res;
-			//				res.m_shape	  = m_shape.subshape(1, ndim());
-			//				auto subSize  = res.shape().size();
-			//				Scalar *begin = m_storage.begin() + index * subSize;
-			//				Scalar *end	  = begin + subSize;
-			//				res.m_storage = StorageType_(begin, end, false);
-			//				return res;
-			//			}
 		}
 
 		template<typename ShapeType_, typename StorageType_>
@@ -819,6 +798,22 @@ namespace librapid {
 			m_storage[index] = value;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		LIBRAPID_ALWAYS_INLINE void
+		ArrayContainer<ShapeType_, StorageType_>::resizeToEvaluate(const T &source, size_t size) {
+			if constexpr (std::is_same_v<StorageType_, Storage<Scalar>>) {
+				// If the elements are shared, the other owners keep them alive, so they only
+				// need to be copied if they are read during the evaluation
+				if (!detail::readsFrom(source, this)) {
+					m_storage.resizeForOverwrite(size);
+					return;
+				}
+			}
+
+			m_storage.resize(size, 0);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		LIBRAPID_ALWAYS_INLINE auto
 		ArrayContainer<ShapeType_, StorageType_>::resize(const ShapeType &shape)
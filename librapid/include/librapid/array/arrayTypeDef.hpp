@@ -87,8 +87,12 @@ namespace librapid {
 	namespace linalg {
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
 				 typename StorageTypeB, typename Alpha = typename StorageTypeA::Scalar,
-				 typename Beta = typename StorageTypeB::Scalar>
+				 typename Beta = typename StorageTypeB::Scalar, bool TransA = false,
+				 bool TransB = false>
 		class ArrayMultiply;
+
+		template<typename Multiply, typename Epilogue>
+		class FusedArrayMultiply;
 	}
 
 	template<typename T>
@@ -0,0 +1,180 @@
+#ifndef LIBRAPID_ARRAY_ASSIGN_MANY_HPP
+#define LIBRAPID_ARRAY_ASSIGN_MANY_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Evaluates as true if an object can be evaluated directly (one element or packet at a
+		/// time) as part of a multi-output assignment
+		/// \tparam T The type of the object
+		template<typename T>
+		struct IsDirectlyEvaluable {
+			static constexpr bool value =
+			  typetraits::TypeInfo<T>::type == LibRapidType::ArrayContainer ||
+			  typetraits::TypeInfo<T>::type == LibRapidType::GeneralArrayView;
+		};
+
+		template<typename Functor_, typename... Args>
+		struct IsDirectlyEvaluable<Function<descriptor::Trivial, Functor_, Args...>> {
+			static constexpr bool value =
+			  !typetraits::HasCustomEval<Function<descriptor::Trivial, Functor_, Args...>>::value;
+		};
+
+		/// Information about a multi-output assignment
+		/// \tparam Destinations The types of the arrays being assigned to
+		/// \tparam Functions The types of the expressions being assigned
+		template<typename Destinations, typename... Functions>
+		struct AssignManyTraits;
+
+		template<typename... Destinations, typename... Functions>
+		struct AssignManyTraits<std::tuple<Destinations &...>, Functions...> {
+			template<typename T>
+			using ScalarOf = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+
+			template<typename T>
+			using StorageOf = typename typetraits::TypeInfo<std::decay_t<T>>::StorageType;
+
+			template<typename T>
+			using BackendOf = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+
+			using Scalar = ScalarOf<std::tuple_element_t<0, std::tuple<Destinations...>>>;
+
+			/// All destinations are contiguous CPU arrays, and all expressions can be evaluated
+			/// elementwise, so they can share a single loop
+			static constexpr bool fused =
+			  (typetraits::IsArrayContainer<std::decay_t<Destinations>>::value && ...) &&
+			  (std::is_same_v<StorageOf<Destinations>, Storage<ScalarOf<Destinations>>> && ...) &&
+			  (std::is_same_v<BackendOf<Functions>, backend::CPU> && ...) &&
+			  (IsDirectlyEvaluable<std::decay_t<Functions>>::value && ...);
+
+			/// Every destination and expression shares the same scalar type and supports
+			/// vectorisation, so the loop can be evaluated one packet at a time
+			static constexpr bool vectorise = []() {
+				if constexpr (fused) {
+					return (std::is_same_v<ScalarOf<Destinations>, Scalar> && ...) &&
+						   (std::is_same_v<ScalarOf<Functions>, Scalar> && ...) &&
+						   (typetraits::TypeInfo<std::decay_t<Functions>>::allowVectorisation &&
+							...) &&
+						   typetraits::TypeInfo<Scalar>::packetWidth > 1;
+				} else {
+					return false;
+				}
+			}();
+		};
+
+		/// Evaluate a range of elements of a multi-output assignment. Every expression is
+		/// evaluated at an index before any output is written there, so a destination may also
+		/// be an operand of any of the expressions.
+		/// \tparam Vectorise If true, evaluate one packet at a time
+		/// \tparam Outputs A tuple of pointers to the elements of each destination
+		/// \tparam Functions The types of the expressions being assigned
+		/// \tparam I Index sequence over the outputs
+		/// \param outputs The elements of the arrays to assign to, which must not be shared
+		/// \param functions The expressions to assign
+		/// \param start The first index to evaluate (a multiple of the packet width)
+		/// \param end One past the last index to evaluate
+		template<bool Vectorise, typename Outputs, typename Functions, size_t... I>
+		LIBRAPID_ALWAYS_INLINE void assignManyRange(const Outputs &outputs,
+													const Functions &functions,
+													std::index_sequence<I...>, int64_t start,
+													int64_t end) {
+			int64_t index = start;
+
+			if constexpr (Vectorise) {
+				using Scalar = std::remove_pointer_t<std::tuple_element_t<0, Outputs>>;
+				constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+				const int64_t vectorEnd		  = end - ((end - start) % packetWidth);
+
+				for (; index < vectorEnd; index += packetWidth) {
+					const auto packets = std::make_tuple(std::get<I>(functions).packet(index)...);
+					(std::get<I>(packets).store_unaligned(std::get<I>(outputs) + index), ...);
+				}
+			}
+
+			for (; index < end; ++index) {
+				const auto scalars = std::make_tuple(std::get<I>(functions).scalar(index)...);
+				((std::get<I>(outputs)[index] = std::get<I>(scalars)), ...);
+			}
+		}
+	} // namespace detail
+
+	/// \brief Assign several expressions to several arrays in a single pass
+	///
+	/// Evaluates every expression over the same index space in one (vectorised, and potentially
+	/// parallel) loop. When several expressions read the same large inputs, for example an
+	/// activation function and its derivative, each input is only streamed through the cache
+	/// once, rather than once per expression.
+	///
+	/// \code{.cpp}
+	/// auto x = lrc::Array<float>(lrc::Shape({1000, 1000}));
+	/// auto y = lrc::emptyLike(x);
+	/// auto z = lrc::emptyLike(x);
+	/// lrc::assignMany(std::tie(y, z), lrc::exp(x), x * x + 1.0f);
+	/// \endcode
+	///
+	/// Every expression must have the same shape, and every destination must already have that
+	/// shape -- the destinations are never resized. A destination may also appear as an operand
+	/// of the expressions. If the assignment cannot be fused (e.g. because one of the
+	/// destinations lives on the GPU, or one of the expressions requires a custom evaluation),
+	/// each expression is assigned separately.
+	///
+	/// \tparam Destinations The types of the arrays being assigned to
+	/// \tparam Functions The types of the expressions being assigned
+	/// \param destinations A tuple of references to the arrays to assign to (see std::tie)
+	/// \param functions The expressions to assign, in the same order as the destinations
+	template<typename... Destinations, typename... Functions>
+		requires(sizeof...(Destinations) == sizeof...(Functions) && sizeof...(Functions) > 0)
+	LIBRAPID_ALWAYS_INLINE void assignMany(std::tuple<Destinations &...> destinations,
+										   const Functions &...functions) {
+		using Traits = detail::AssignManyTraits<std::tuple<Destinations &...>, Functions...>;
+		constexpr auto indices = std::index_sequence_for<Functions...>();
+
+		const auto expressions = std::tie(functions...);
+		const int64_t size	   = static_cast<int64_t>(std::get<0>(expressions).shape().size());
+
+		// The same requirements apply whether or not the assignment is fused
+		[&]<size_t... I>(std::index_sequence<I...>) {
+			(LIBRAPID_ASSERT_WITH_EXCEPTION(
+			   std::range_error,
+			   std::get<I>(destinations).shape() == std::get<I>(expressions).shape() &&
+				 static_cast<int64_t>(std::get<I>(expressions).shape().size()) == size,
+			   "Shapes must be equal. Output {} has shape {}, but expression has shape {}",
+			   I,
+			   std::get<I>(destinations).shape(),
+			   std::get<I>(expressions).shape()),
+			 ...);
+		}(indices);
+
+		if constexpr (Traits::fused) {
+			constexpr bool vectorise = Traits::vectorise;
+
+			// Detach each destination from any copies once, rather than on every write
+			const auto outputs = [&]<size_t... I>(std::index_sequence<I...>) {
+				return std::make_tuple(std::get<I>(destinations).storage().begin()...);
+			}(indices);
+
+			if (size > static_cast<int64_t>(global::multithreadThreshold) &&
+				global::numThreads > 1) {
+				// Keep every chunk packet-aligned
+				constexpr int64_t blockSize =
+				  vectorise ? typetraits::TypeInfo<typename Traits::Scalar>::packetWidth : 1;
+
+				parallelFor(
+				  0,
+				  size,
+				  [&](int64_t start, int64_t end) {
+					  detail::assignManyRange<vectorise>(outputs, expressions, indices, start, end);
+				  },
+				  blockSize);
+				return;
+			}
+
+			detail::assignManyRange<vectorise>(outputs, expressions, indices, 0, size);
+		} else {
+			[&]<size_t... I>(std::index_sequence<I...>) {
+				((std::get<I>(destinations) = functions), ...);
+			}(indices);
+		}
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ASSIGN_MANY_HPP
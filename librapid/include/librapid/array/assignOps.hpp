@@ -6,6 +6,264 @@ namespace librapid {
 	// elsewhere. They are defined here.
 
 	namespace detail {
+		/// Evaluates as true if evaluating the input type reads memory in a different order to
+		/// the row-major order of the result (i.e. it contains a transposition). Such expressions
+		/// are evaluated in cache-sized tiles rather than in a single linear pass.
+		///
+		/// Expressions which only read many operands (or are deeply nested) are not tiled. Every
+		/// operand is still read in row-major order, so splitting the rows into tiles would not
+		/// reduce the data loaded from memory and would break the hardware prefetcher's streams.
+		/// \tparam T The type to check
+		template<typename T>
+		struct NeedsTiledEvaluation : std::false_type {};
+
+		template<typename T>
+		struct NeedsTiledEvaluation<array::Transpose<T>> : std::true_type {};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct NeedsTiledEvaluation<Function<desc, Functor_, Args...>>
+				: std::bool_constant<(NeedsTiledEvaluation<std::decay_t<Args>>::value || ...)> {};
+
+		/// Evaluates as true if \p T is an elementwise expression
+		/// \tparam T The type to check
+		template<typename T>
+		struct IsFunction : std::false_type {};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct IsFunction<Function<desc, Functor_, Args...>> : std::true_type {};
+
+		/// Returns true if evaluating \p val may read the elements of the array container at
+		/// address \p array. Objects which are not understood are assumed to read it.
+		/// \tparam T The type of the object being evaluated
+		/// \param val The object being evaluated
+		/// \param array The address of the array container
+		/// \return False if \p val definitely does not read \p array
+		template<typename T>
+		LIBRAPID_NODISCARD bool readsFrom(const T &val, const void *array) {
+			if constexpr (IsFunction<T>::value) {
+				return std::apply(
+				  [array](const auto &...args) { return (readsFrom(args, array) || ...); },
+				  val.args());
+			} else if constexpr (typetraits::IsArrayContainer<T>::value) {
+				return static_cast<const void *>(&val) == array;
+			} else if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::GeneralArrayView) {
+				return readsFrom(val.base(), array);
+			} else {
+				return typetraits::TypeInfo<T>::type != LibRapidType::Scalar;
+			}
+		}
+
+		/// The number of array operands read when evaluating an expression
+		/// \tparam T The type to check
+		template<typename T>
+		struct OperandCount {
+			static constexpr int64_t value = IsArrayType<T>::val ? 1 : 0;
+		};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct OperandCount<Function<desc, Functor_, Args...>> {
+			static constexpr int64_t value = (OperandCount<std::decay_t<Args>>::value + ...);
+		};
+
+		/// Compute the dimensions of the tiles used for cache-blocked evaluation. A tile, along
+		/// with the corresponding elements of every operand, fits in half of the L2 cache, and its
+		/// width is a whole number of cache lines.
+		/// \tparam Scalar The scalar type of the result
+		/// \param rows The number of rows in the result
+		/// \param cols The number of columns (the extent of the innermost dimension) of the result
+		/// \param operands The number of array operands read by the expression
+		/// \return The number of rows and columns in each tile
+		template<typename Scalar>
+		LIBRAPID_NODISCARD auto tileShape(int64_t rows, int64_t cols, int64_t operands)
+		  -> std::pair<int64_t, int64_t> {
+			const int64_t lineElements =
+			  std::max<int64_t>(1, global::cacheLineSize / sizeof(Scalar));
+			const int64_t bytesPerElement = sizeof(Scalar) * (operands + 1);
+			const int64_t tileElements	  = std::max<int64_t>(
+				 lineElements * lineElements, global::l2CacheSize / 2 / bytesPerElement);
+
+			int64_t tileCols = static_cast<int64_t>(std::sqrt(static_cast<double>(tileElements)));
+			tileCols		 = std::max(lineElements, tileCols - tileCols % lineElements);
+			tileCols		 = std::min(tileCols, cols);
+
+			const int64_t tileRows = std::clamp<int64_t>(tileElements / tileCols, 1, rows);
+			return {tileRows, tileCols};
+		}
+
+		/// Evaluate a band of rows of an expression, one tile at a time. Each row of a tile is a
+		/// contiguous run of the result, which is evaluated in packets when the expression
+		/// supports it.
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Function The function type
+		/// \param data The elements of the result, which must not be shared
+		/// \param function The function to assign
+		/// \param cols The number of columns in the result
+		/// \param tileCols The number of columns in each tile
+		/// \param rowBegin The first row of the band
+		/// \param rowEnd One past the last row of the band
+		template<typename Scalar, typename Function>
+		LIBRAPID_ALWAYS_INLINE void assignTileBand(Scalar *data, const Function &function,
+												   int64_t cols, int64_t tileCols,
+												   int64_t rowBegin, int64_t rowEnd) {
+			constexpr bool allowVectorisation =
+			  typetraits::TypeInfo<Function>::allowVectorisation &&
+			  std::is_same_v<typename Function::Scalar, Scalar>;
+			constexpr int64_t packetWidth = []() {
+				if constexpr (allowVectorisation) {
+					return typetraits::TypeInfo<Scalar>::packetWidth;
+				} else {
+					return 1;
+				}
+			}();
+
+			for (int64_t colBegin = 0; colBegin < cols; colBegin += tileCols) {
+				const int64_t colEnd = std::min(colBegin + tileCols, cols);
+				for (int64_t row = rowBegin; row < rowEnd; ++row) {
+					const int64_t offset = row * cols;
+					int64_t index		 = offset + colBegin;
+
+					if constexpr (allowVectorisation) {
+						for (; index + packetWidth <= offset + colEnd; index += packetWidth) {
+							function.packet(index).store_unaligned(data + index);
+						}
+					}
+
+					for (; index < offset + colEnd; ++index) {
+						data[index] = static_cast<Scalar>(function.scalar(index));
+					}
+				}
+			}
+		}
+
+		/// Cache-blocked assignment -- the result is treated as a matrix whose rows are the
+		/// innermost dimension, and is evaluated in tiles which fit in the L2 cache. This improves
+		/// locality for expressions which read their operands in different orders (e.g.
+		/// a + transpose(b)). When running in parallel, each thread owns a contiguous band of
+		/// tiles.
+		/// \tparam Destination The array container type to assign to
+		/// \tparam Function The function type
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \param parallel If true, evaluate the tiles in parallel
+		template<typename Destination, typename Function>
+		LIBRAPID_ALWAYS_INLINE void assignTiled(Destination &lhs, const Function &function,
+												bool parallel) {
+			using Scalar = typename Destination::Scalar;
+
+			const auto &shape  = function.shape();
+			const int64_t cols = shape[shape.ndim() - 1];
+			const int64_t rows = cols == 0 ? 0 : static_cast<int64_t>(function.size()) / cols;
+			if (rows == 0) return;
+
+			const auto tile = tileShape<Scalar>(rows, cols, OperandCount<Function>::value);
+			const int64_t tileRows = tile.first;
+			const int64_t tileCols = tile.second;
+			const int64_t bands	   = (rows + tileRows - 1) / tileRows;
+
+			// Detach the destination from any copies once, rather than on every write
+			Scalar *data = lhs.storage().begin();
+
+			auto assignBand = [&](int64_t band) {
+				const int64_t rowBegin = band * tileRows;
+				const int64_t rowEnd   = std::min(rowBegin + tileRows, rows);
+				assignTileBand(data, function, cols, tileCols, rowBegin, rowEnd);
+			};
+
+			if (parallel) {
+				parallelFor(0, bands, assignBand);
+			} else {
+				for (int64_t band = 0; band < bands; ++band) { assignBand(band); }
+			}
+		}
+
+		/// Store a packet with a non-temporal (streaming) store, which writes directly to memory
+		/// without first reading the destination cache line, and without evicting other data
+		/// from the cache. \p ptr must be aligned to the size of the packet. On architectures
+		/// without streaming stores, this is a regular aligned store.
+		/// \tparam Scalar The scalar type of the destination
+		/// \tparam Packet The packet type
+		/// \param ptr The (aligned) destination
+		/// \param packet The packet to store
+		template<typename Scalar, typename Packet>
+		LIBRAPID_ALWAYS_INLINE void streamPacket(Scalar *ptr, const Packet &packet) {
+			[[maybe_unused]] constexpr bool isFloat	 = std::is_same_v<Scalar, float>;
+			[[maybe_unused]] constexpr bool isDouble = std::is_same_v<Scalar, double>;
+			[[maybe_unused]] constexpr bool isInteger =
+			  std::is_integral_v<Scalar> && !std::is_same_v<Scalar, bool>;
+
+#if LIBRAPID_ARCH >= ARCH_AVX512
+			if constexpr (sizeof(Packet) == 64) {
+				if constexpr (isFloat) {
+					_mm512_stream_ps(ptr, packet);
+					return;
+				} else if constexpr (isDouble) {
+					_mm512_stream_pd(ptr, packet);
+					return;
+				} else if constexpr (isInteger) {
+					_mm512_stream_si512(reinterpret_cast<__m512i *>(ptr), packet);
+					return;
+				}
+			}
+#endif
+
+#if LIBRAPID_ARCH >= ARCH_AVX
+			if constexpr (sizeof(Packet) == 32) {
+				if constexpr (isFloat) {
+					_mm256_stream_ps(ptr, packet);
+					return;
+				} else if constexpr (isDouble) {
+					_mm256_stream_pd(ptr, packet);
+					return;
+				} else if constexpr (isInteger) {
+					_mm256_stream_si256(reinterpret_cast<__m256i *>(ptr), packet);
+					return;
+				}
+			}
+#endif
+
+#if LIBRAPID_ARCH >= ARCH_SSE2
+			if constexpr (sizeof(Packet) == 16) {
+				if constexpr (isFloat) {
+					_mm_stream_ps(ptr, packet);
+					return;
+				} else if constexpr (isDouble) {
+					_mm_stream_pd(ptr, packet);
+					return;
+				} else if constexpr (isInteger) {
+					_mm_stream_si128(reinterpret_cast<__m128i *>(ptr), packet);
+					return;
+				}
+			}
+#endif
+
+			packet.store_aligned(ptr);
+		}
+
+		/// Order all previous streaming stores made by the calling thread before any subsequent
+		/// stores, making the data visible to other threads
+		LIBRAPID_ALWAYS_INLINE void streamFence() {
+#if LIBRAPID_ARCH >= ARCH_SSE2
+			_mm_sfence();
+#else
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+		}
+
+		/// Evaluates to true if an assignment should write its result with streaming stores.
+		/// This is the case when the destination is too large to remain in the cache (see
+		/// global::streamingStoreThreshold) and is aligned to the size of a packet.
+		/// \tparam Packet The packet type used to write the result
+		/// \tparam Scalar The scalar type of the destination
+		/// \param ptr Pointer to the destination
+		/// \param size Number of elements being written
+		/// \return True if streaming stores should be used
+		template<typename Packet, typename Scalar>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool useStreamingStores(const Scalar *ptr,
+																		  size_t size) {
+			return size * sizeof(Scalar) >= global::streamingStoreThreshold &&
+				   reinterpret_cast<uintptr_t>(ptr) % sizeof(Packet) == 0;
+		}
+
 		/// Trivial array assignment operator -- assignment can be done with a single vectorised
 		/// loop over contiguous data.
 		/// \tparam ShapeType_ The shape type of the array container
@@ -26,7 +284,7 @@ namespace librapid {
 			constexpr bool allowVectorisation =
 			  typetraits::TypeInfo<
 				detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-			  Function::argsAreSameType;
+			  std::is_same_v<typename Function::Scalar, Scalar>;
 			constexpr int64_t packetWidth = []() {
 				if constexpr (allowVectorisation) {
 					return typetraits::TypeInfo<Scalar>::packetWidth;
@@ -48,19 +306,38 @@ namespace librapid {
 										   lhs.shape(),
 										   function.shape());
 
+			if constexpr (NeedsTiledEvaluation<Function>::value) {
+				if (function.ndim() >= 2) {
+					assignTiled(lhs, function, false);
+					return;
+				}
+			}
+
+			// Detach the destination from any copies once, rather than on every write
+			Scalar *data = lhs.storage().begin();
+
 			if constexpr (allowVectorisation) {
-				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-					lhs.writePacket(index, function.packet(index));
+				using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+
+				if (useStreamingStores<Packet>(data, size)) {
+					for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+						streamPacket(data + index, function.packet(index));
+					}
+					streamFence();
+				} else {
+					for (int64_t index = 0; index < vectorSize; index += packetWidth) {
+						function.packet(index).store_unaligned(data + index);
+					}
 				}
 
 				// Assign the remaining elements
 				for (int64_t index = vectorSize; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
+					data[index] = static_cast<Scalar>(function.scalar(index));
 				}
 			} else {
 				// Assign the remaining elements
 				for (int64_t index = 0; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
+					data[index] = static_cast<Scalar>(function.scalar(index));
 				}
 			}
 		}
@@ -86,7 +363,7 @@ namespace librapid {
 			constexpr bool allowVectorisation =
 			  typetraits::TypeInfo<
 				detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-			  Function::argsAreSameType;
+			  std::is_same_v<typename Function::Scalar, Scalar>;
 			constexpr int64_t packetWidth = []() {
 				if constexpr (allowVectorisation) {
 					return typetraits::TypeInfo<Scalar>::packetWidth;
@@ -147,7 +424,7 @@ namespace librapid {
 			constexpr bool allowVectorisation =
 			  typetraits::TypeInfo<
 				detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-			  Function::argsAreSameType;
+			  std::is_same_v<typename Function::Scalar, Scalar>;
 			constexpr int64_t packetWidth = []() {
 				if constexpr (allowVectorisation) {
 					return typetraits::TypeInfo<Scalar>::packetWidth;
@@ -171,23 +448,53 @@ namespace librapid {
 										   lhs.shape(),
 										   function.shape());
 
+			if constexpr (NeedsTiledEvaluation<Function>::value) {
+				if (function.ndim() >= 2) {
+					assignTiled(lhs, function, true);
+					return;
+				}
+			}
+
+			// Detach the destination from any copies once, rather than on every write
+			Scalar *data = lhs.storage().begin();
+
 			if constexpr (allowVectorisation) {
-#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
-  num_threads(int(global::numThreads))
-				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-					lhs.writePacket(index, function.packet(index));
+				using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+
+				if (useStreamingStores<Packet>(data, size)) {
+					// Each chunk must fence its own streaming stores
+					parallelFor(
+					  0,
+					  int64_t(vectorSize),
+					  [&](int64_t first, int64_t last) {
+						  for (int64_t index = first; index < last; index += packetWidth) {
+							  streamPacket(data + index, function.packet(index));
+						  }
+						  streamFence();
+					  },
+					  packetWidth);
+				} else {
+					parallelFor(
+					  0,
+					  int64_t(vectorSize),
+					  [&](int64_t first, int64_t last) {
+						  for (int64_t index = first; index < last; index += packetWidth) {
+							  function.packet(index).store_unaligned(data + index);
+						  }
+					  },
+					  packetWidth);
 				}
 
 				// Assign the remaining elements
 				for (int64_t index = vectorSize; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
+					data[index] = static_cast<Scalar>(function.scalar(index));
 				}
 			} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
-  num_threads(int(global::numThreads))
-				for (int64_t index = 0; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
-				}
+				parallelFor(0, int64_t(size), [&](int64_t first, int64_t last) {
+					for (int64_t index = first; index < last; ++index) {
+						data[index] = static_cast<Scalar>(function.scalar(index));
+					}
+				});
 			}
 		}
 
@@ -212,7 +519,7 @@ namespace librapid {
 			constexpr bool allowVectorisation =
 			  typetraits::TypeInfo<
 				detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-			  Function::argsAreSameType;
+			  std::is_same_v<typename Function::Scalar, Scalar>;
 			constexpr int64_t packetWidth = []() {
 				if constexpr (allowVectorisation) {
 					return typetraits::TypeInfo<Scalar>::packetWidth;
@@ -235,21 +542,120 @@ namespace librapid {
 										   function.shape());
 
 			if constexpr (allowVectorisation) {
-#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
-  num_threads(int(global::numThreads))
-				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-					lhs.writePacket(index, function.packet(index));
-				}
+				parallelFor(
+				  0,
+				  vectorSize,
+				  [&](int64_t first, int64_t last) {
+					  for (int64_t index = first; index < last; index += packetWidth) {
+						  lhs.writePacket(index, function.packet(index));
+					  }
+				  },
+				  packetWidth);
 
 				// Assign the remaining elements
 				for (int64_t index = vectorSize; index < size; ++index) {
 					lhs.write(index, function.scalar(index));
 				}
 			} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
-  num_threads(int(global::numThreads))
-				for (int64_t index = vectorSize; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
+				parallelFor(0, size, [&](int64_t first, int64_t last) {
+					for (int64_t index = first; index < last; ++index) {
+						lhs.write(index, function.scalar(index));
+					}
+				});
+			}
+		}
+
+		/// Strided assignment from a GeneralArrayView -- the outer dimensions of the view are
+		/// traversed with an odometer, so no index arithmetic is required per element, and each
+		/// row of the innermost dimension is copied with packet loads (when the row is contiguous)
+		/// or strided gathers (when it is not).
+		/// \tparam ShapeType_ The shape type of the array container
+		/// \tparam StorageScalar The scalar type of the storage object
+		/// \tparam ArrayViewType The array type referenced by the view
+		/// \tparam ArrayViewShapeType The shape type of the view
+		/// \param lhs The array container to assign to
+		/// \param view The view to assign
+		template<typename ShapeType_, typename StorageScalar, typename ArrayViewType,
+				 typename ArrayViewShapeType>
+		LIBRAPID_FLATTEN LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar>> &lhs,
+			   const array::GeneralArrayView<ArrayViewType, ArrayViewShapeType> &view) {
+			using View	 = array::GeneralArrayView<ArrayViewType, ArrayViewShapeType>;
+			using Scalar = StorageScalar;
+			constexpr bool allowVectorisation =
+			  typetraits::TypeInfo<View>::allowVectorisation &&
+			  std::is_same_v<typename View::Scalar, Scalar>;
+			constexpr int64_t packetWidth = []() {
+				if constexpr (allowVectorisation) {
+					return typetraits::TypeInfo<Scalar>::packetWidth;
+				} else {
+					return 1;
+				}
+			}();
+
+			LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+										   lhs.shape().operator==(view.shape()),
+										   "Shapes must be equal. Expected {}, received {}",
+										   lhs.shape(),
+										   view.shape());
+
+			const int64_t ndim = view.ndim();
+			Scalar *dst		   = lhs.storage().data();
+
+			if (ndim == 0) {
+				dst[0] = static_cast<Scalar>(view.scalar(0));
+				return;
+			}
+
+			const auto shape		  = view.shape();
+			const auto stride		  = view.stride();
+			const int64_t size		  = shape.size();
+			const int64_t innerExtent = shape[ndim - 1];
+			const int64_t innerStride = stride[ndim - 1];
+			const int64_t vectorSize  = innerExtent - (innerExtent % packetWidth);
+
+			if (size == 0) return;
+
+			auto coord	   = ArrayViewShapeType::zeros(ndim);
+			int64_t source = view.offset();
+
+			for (int64_t row = 0; row < size; row += innerExtent) {
+				Scalar *out = dst + row;
+				int64_t col = 0;
+
+				if constexpr (allowVectorisation) {
+					const Scalar *in = view.base().storage().data() + source;
+
+					using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+
+					if (innerStride == 1) {
+						for (; col < vectorSize; col += packetWidth) {
+							xsimd::load_unaligned(in + col).store_unaligned(out + col);
+						}
+					} else {
+						for (; col < vectorSize; col += packetWidth) {
+							detail::gatherStrided<Packet>(in + col * innerStride, innerStride)
+							  .store_unaligned(out + col);
+						}
+					}
+
+					// The tail of each row is copied element-wise
+					for (; col < innerExtent; ++col) { out[col] = in[col * innerStride]; }
+				} else {
+					const auto &base = view.base();
+					for (; col < innerExtent; ++col) {
+						out[col] = static_cast<Scalar>(base.scalar(source + col * innerStride));
+					}
+				}
+
+				// Advance the odometer over every dimension except the innermost one
+				for (int64_t dim = ndim - 2; dim >= 0; --dim) {
+					if (++coord[dim] < shape[dim]) {
+						source += stride[dim];
+						break;
+					}
+					coord[dim] = 0;
+					source -= (static_cast<int64_t>(shape[dim]) - 1) * stride[dim];
 				}
 			}
 		}
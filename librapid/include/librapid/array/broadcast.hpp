@@ -0,0 +1,206 @@
+#ifndef LIBRAPID_ARRAY_BROADCAST_HPP
+#define LIBRAPID_ARRAY_BROADCAST_HPP
+
+namespace librapid::detail {
+	/// Compute the shape resulting from broadcasting two shapes together, following the same
+	/// rules as NumPy: shapes are aligned on their last dimension, missing leading dimensions
+	/// are treated as having extent 1, and each pair of dimensions must either match or
+	/// contain a 1.
+	/// \tparam ResultShape The shape type to return
+	/// \tparam ShapeA The type of the first shape
+	/// \tparam ShapeB The type of the second shape
+	/// \param a The first shape
+	/// \param b The second shape
+	/// \return The broadcast shape
+	template<typename ResultShape, typename ShapeA, typename ShapeB>
+	LIBRAPID_NODISCARD auto broadcastShapes(const ShapeA &a, const ShapeB &b) -> ResultShape {
+		const int64_t ndimA = a.ndim();
+		const int64_t ndimB = b.ndim();
+		const int64_t ndim	= ::librapid::max(ndimA, ndimB);
+
+		Shape result = Shape::zeros(ndim);
+		for (int64_t i = 0; i < ndim; ++i) {
+			const int64_t dimA	 = i - (ndim - ndimA);
+			const int64_t dimB	 = i - (ndim - ndimB);
+			const size_t extentA = dimA >= 0 ? a[dimA] : 1;
+			const size_t extentB = dimB >= 0 ? b[dimB] : 1;
+
+			LIBRAPID_ASSERT_WITH_EXCEPTION(
+			  std::range_error,
+			  extentA == extentB || extentA == 1 || extentB == 1,
+			  "Shapes {} and {} cannot be broadcast together (dimension {}: {} vs {})",
+			  a,
+			  b,
+			  i,
+			  extentA,
+			  extentB);
+
+			result[i] = extentA == 1 ? extentB : extentA;
+		}
+
+		if constexpr (std::is_same_v<ResultShape, Shape>) {
+			return result;
+		} else {
+			ResultShape converted = ResultShape::zeros(ndim);
+			for (int64_t i = 0; i < ndim; ++i) { converted[i] = result[i]; }
+			return converted;
+		}
+	}
+
+	/// Compute the shape resulting from broadcasting every array argument of a function
+	/// together. Scalar arguments do not contribute to the shape.
+	/// \tparam ResultShape The shape type to return
+	/// \tparam Args The argument types
+	/// \param args The arguments
+	/// \return The broadcast shape
+	template<typename ResultShape, typename... Args>
+	LIBRAPID_NODISCARD auto broadcastArgumentShapes(const std::tuple<Args...> &args)
+	  -> ResultShape {
+		Shape result = Shape::zeros(0);
+		std::apply(
+		  [&result](const auto &...arg) {
+			  auto merge = [&result](const auto &value) {
+				  if constexpr (IsArrayType<std::decay_t<decltype(value)>>::val) {
+					  result = broadcastShapes<Shape>(result, value.shape());
+				  }
+			  };
+			  (merge(arg), ...);
+		  },
+		  args);
+		return broadcastShapes<ResultShape>(result, result);
+	}
+
+	/// Maps linear indices into the result of a broadcast operation onto linear indices into
+	/// one of its (smaller) operands. Broadcast dimensions have a stride of zero in the operand,
+	/// and adjacent dimensions which are traversed in the same way are merged so that the
+	/// common cases (e.g. adding a row vector to every row of a matrix) only require a single
+	/// division per lookup.
+	class BroadcastIndexer {
+	public:
+		/// Construct an indexer mapping from \p result onto \p source
+		/// \tparam ResultShape The shape type of the result
+		/// \tparam SourceShape The shape type of the operand
+		/// \param result The shape of the broadcast result
+		/// \param source The shape of the operand
+		template<typename ResultShape, typename SourceShape>
+		BroadcastIndexer(const ResultShape &result, const SourceShape &source);
+
+		/// Convert a linear index into the result into a linear index into the operand
+		/// \param index The index into the result
+		/// \return The corresponding index into the operand
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto map(size_t index) const -> size_t;
+
+		/// Load a scalar from the operand at the position corresponding to \p index in the
+		/// result
+		/// \tparam T The type of the operand
+		/// \param source The operand
+		/// \param index The index into the result
+		/// \return The scalar value
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalar(const T &source,
+															  size_t index) const {
+			return source.scalar(map(index));
+		}
+
+		/// Load a packet from the operand, starting at the position corresponding to \p index in
+		/// the result. If every lane falls within a single innermost row, a broadcast inner
+		/// dimension becomes a single splatted value and a contiguous one becomes a packet load
+		/// from the operand (unaligned, for host arrays). Otherwise, the lanes are gathered
+		/// individually.
+		/// \tparam Packet The packet type to return
+		/// \tparam T The type of the operand
+		/// \param source The operand
+		/// \param index The index into the result
+		/// \return The packet
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(const T &source,
+																size_t index) const;
+
+	private:
+		int64_t m_ndim = 0;
+		std::array<size_t, LIBRAPID_MAX_ARRAY_DIMS> m_extent {}; // Extents of the result
+		std::array<size_t, LIBRAPID_MAX_ARRAY_DIMS> m_stride {}; // Operand strides (0: broadcast)
+	};
+
+	template<typename ResultShape, typename SourceShape>
+	BroadcastIndexer::BroadcastIndexer(const ResultShape &result, const SourceShape &source) {
+		const int64_t ndim		 = result.ndim();
+		const int64_t sourceNdim = source.ndim();
+
+		// Contiguous strides of the operand, aligned with the dimensions of the result
+		std::array<size_t, LIBRAPID_MAX_ARRAY_DIMS> stride {};
+		size_t step = 1;
+		for (int64_t i = ndim - 1; i >= 0; --i) {
+			const int64_t sourceDim = i - (ndim - sourceNdim);
+			const size_t extent		= sourceDim >= 0 ? source[sourceDim] : 1;
+			stride[i]				= extent == 1 ? 0 : step;
+			step *= extent;
+		}
+
+		// Merge adjacent dimensions which can be traversed with a single stride
+		for (int64_t i = 0; i < ndim; ++i) {
+			const size_t extent = result[i];
+			if (extent == 1) continue;
+
+			if (m_ndim > 0) {
+				const bool bothBroadcast = m_stride[m_ndim - 1] == 0 && stride[i] == 0;
+				const bool contiguous =
+				  stride[i] != 0 && m_stride[m_ndim - 1] == stride[i] * extent;
+				if (bothBroadcast || contiguous) {
+					m_extent[m_ndim - 1] *= extent;
+					m_stride[m_ndim - 1] = stride[i];
+					continue;
+				}
+			}
+
+			m_extent[m_ndim] = extent;
+			m_stride[m_ndim] = stride[i];
+			++m_ndim;
+		}
+
+		if (m_ndim == 0) {
+			m_extent[0] = 1;
+			m_stride[0] = 0;
+			m_ndim		= 1;
+		}
+	}
+
+	LIBRAPID_ALWAYS_INLINE auto BroadcastIndexer::map(size_t index) const -> size_t {
+		size_t result = 0;
+		for (int64_t i = m_ndim - 1; i >= 0; --i) {
+			result += (index % m_extent[i]) * m_stride[i];
+			index /= m_extent[i];
+		}
+		return result;
+	}
+
+	template<typename Packet, typename T>
+	LIBRAPID_ALWAYS_INLINE Packet BroadcastIndexer::packet(const T &source, size_t index) const {
+		using Scalar				 = typename Packet::value_type;
+		constexpr size_t packetWidth = Packet::size;
+
+		const size_t innerExtent = m_extent[m_ndim - 1];
+		if ((index % innerExtent) + packetWidth <= innerExtent) {
+			const size_t first = map(index);
+			if (m_stride[m_ndim - 1] == 0) return Packet(static_cast<Scalar>(source.scalar(first)));
+
+			// Contiguous runs in host memory can be loaded from any offset. Other operands only
+			// provide aligned packet loads
+			if constexpr (typetraits::IsArrayContainer<T>::value &&
+						  std::is_same_v<typename typetraits::TypeInfo<T>::StorageType,
+										 Storage<Scalar>>) {
+				return Packet::load_unaligned(source.storage().begin() + first);
+			} else {
+				if (first % packetWidth == 0) return source.packet(first);
+			}
+		}
+
+		Scalar buffer[packetWidth];
+		for (size_t lane = 0; lane < packetWidth; ++lane) {
+			buffer[lane] = static_cast<Scalar>(source.scalar(map(index + lane)));
+		}
+		return Packet::load_unaligned(buffer);
+	}
+} // namespace librapid::detail
+
+#endif // LIBRAPID_ARRAY_BROADCAST_HPP
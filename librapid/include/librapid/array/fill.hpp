@@ -8,47 +8,83 @@ namespace librapid {
 		dst = array::ArrayContainer<ShapeType, StorageType>(dst.shape(), value);
 	}
 
+	namespace detail {
+		/// Number of elements generated by each of the random number generators used to fill a
+		/// CPU array. The blocks are fixed, so the values do not depend on the number of threads
+		/// or on how the blocks are shared between them.
+		constexpr int64_t randomFillBlock = 16384;
+
+		/// Fill an array of \p size elements with random values, one block at a time. Each block
+		/// has its own generator, seeded from the global seed, a value drawn once per call from
+		/// the shared generator, and the index of the block. Successive calls therefore produce
+		/// different values, but the result only depends on the seed.
+		/// \tparam FillBlock The type of the block filler
+		/// \param size The number of elements to fill
+		/// \param fillBlock Called as fillBlock(generator, first, last) to fill [first, last)
+		template<typename FillBlock>
+		void fillRandomBlocks(int64_t size, const FillBlock &fillBlock) {
+			const auto seed		 = static_cast<uint64_t>(global::randomSeed);
+			const auto stream	 = static_cast<uint64_t>(randint(0, INT64_MAX));
+			const int64_t blocks = (size + randomFillBlock - 1) / randomFillBlock;
+
+			auto fillBlocks = [&](int64_t firstBlock, int64_t lastBlock) {
+				for (int64_t block = firstBlock; block < lastBlock; ++block) {
+					const auto index = static_cast<uint64_t>(block);
+					std::seed_seq sequence {uint32_t(seed),
+											uint32_t(seed >> 32),
+											uint32_t(stream),
+											uint32_t(stream >> 32),
+											uint32_t(index),
+											uint32_t(index >> 32)};
+					std::mt19937 generator(sequence);
+
+					const int64_t first = block * randomFillBlock;
+					fillBlock(generator, first, std::min(size, first + randomFillBlock));
+				}
+			};
+
+			if (global::numThreads != 1 &&
+				size > static_cast<int64_t>(global::multithreadThreshold)) {
+				parallelFor(0, blocks, fillBlocks);
+			} else {
+				fillBlocks(0, blocks);
+			}
+		}
+	} // namespace detail
+
 	template<typename ShapeType, typename StorageScalar, typename Lower = StorageScalar,
 			 typename Upper = StorageScalar>
 	LIBRAPID_ALWAYS_INLINE void
 	fillRandom(array::ArrayContainer<ShapeType, Storage<StorageScalar>> &dst,
 			   const Lower &lower = 0, const Upper &upper = 1) {
-		ShapeType shape = dst.shape();
 		auto *data		= dst.storage().begin();
-		bool parallel	= global::numThreads != 1 && shape.size() > global::multithreadThreshold;
-
-		if (parallel) {
-#pragma omp parallel for
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = random<StorageScalar>(static_cast<StorageScalar>(lower),
-												static_cast<StorageScalar>(upper));
-			}
-		} else {
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = random<StorageScalar>(static_cast<StorageScalar>(lower),
-												static_cast<StorageScalar>(upper));
-			}
-		}
+		const auto low	= static_cast<StorageScalar>(lower);
+		const auto high	= static_cast<StorageScalar>(upper);
+		using Result	= decltype(low + high);
+
+		detail::fillRandomBlocks(
+		  int64_t(dst.shape().size()), [&](std::mt19937 &generator, int64_t first, int64_t last) {
+			  std::uniform_real_distribution<double> distribution(0., 1.);
+			  for (int64_t i = first; i < last; ++i) {
+				  data[i] = static_cast<StorageScalar>(
+					static_cast<Result>(low + (high - low) * distribution(generator)));
+			  }
+		  });
 	}
 
 	template<typename ShapeType, typename StorageScalar, typename Lower, typename Upper>
 	LIBRAPID_ALWAYS_INLINE void
 	fillRandomGaussian(array::ArrayContainer<ShapeType, Storage<StorageScalar>> &dst,
 					   const Lower &lower, const Upper &upper) {
-		ShapeType shape = dst.shape();
-		auto *data		= dst.storage().begin();
-		bool parallel	= global::numThreads != 1 && shape.size() > global::multithreadThreshold;
-
-		if (parallel) {
-#pragma omp parallel for
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = randomGaussian<StorageScalar>();
-			}
-		} else {
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = randomGaussian<StorageScalar>();
-			}
-		}
+		auto *data = dst.storage().begin();
+
+		detail::fillRandomBlocks(
+		  int64_t(dst.shape().size()), [&](std::mt19937 &generator, int64_t first, int64_t last) {
+			  std::normal_distribution<double> distribution(0., 1.);
+			  for (int64_t i = first; i < last; ++i) {
+				  data[i] = static_cast<StorageScalar>(distribution(generator));
+			  }
+		  });
 	}
 
 #if defined(LIBRAPID_HAS_OPENCL)
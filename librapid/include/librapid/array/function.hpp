@@ -3,19 +3,31 @@
 
 namespace librapid {
 	namespace typetraits {
-		// Extract allowVectorisation from the input types
-		template<typename First, typename... T>
-		constexpr bool checkAllowVectorisation() {
-			if constexpr (sizeof...(T) == 0) {
-				return TypeInfo<std::decay_t<First>>::allowVectorisation;
+		/// Evaluates as true if packets of \p From can be converted to packets of \p To. This is
+		/// possible for the built-in arithmetic types, which xsimd can convert between in
+		/// registers (see xsimd::batch_cast) or while loading from memory.
+		/// \tparam From The scalar type of the input
+		/// \tparam To The scalar type of the output
+		template<typename From, typename To>
+		constexpr bool packetConvertible() {
+			if constexpr (std::is_same_v<From, To>) {
+				return true;
 			} else {
-				using T1 = typename TypeInfo<std::decay_t<First>>::Scalar;
-				return TypeInfo<std::decay_t<First>>::allowVectorisation &&
-					   checkAllowVectorisation<T...>() &&
-					   (std::is_same_v<T1, typename TypeInfo<std::decay_t<T>>::Scalar> && ...);
+				return std::is_arithmetic_v<From> && std::is_arithmetic_v<To> &&
+					   !std::is_same_v<From, bool> && !std::is_same_v<To, bool> &&
+					   TypeInfo<From>::allowVectorisation && TypeInfo<To>::allowVectorisation;
 			}
 		}
 
+		// Extract allowVectorisation from the input types. Inputs with a different scalar type to
+		// the result are converted to the result's packet type as they are loaded.
+		template<typename Result, typename... Args>
+		constexpr bool checkAllowVectorisation() {
+			return ((TypeInfo<std::decay_t<Args>>::allowVectorisation &&
+					 packetConvertible<typename TypeInfo<std::decay_t<Args>>::Scalar, Result>()) &&
+					...);
+		}
+
 		template<typename First, typename... Rest>
 		constexpr auto commonBackend() {
 			using FirstBackend = typename TypeInfo<std::decay_t<First>>::Backend;
@@ -95,7 +107,7 @@ namespace librapid {
 			using ArrayType	  = Array<Scalar, Backend>;
 			using StorageType = typename TypeInfo<ArrayType>::StorageType;
 
-			static constexpr bool allowVectorisation = checkAllowVectorisation<Args...>();
+			static constexpr bool allowVectorisation = checkAllowVectorisation<Scalar, Args...>();
 
 			static constexpr bool supportsArithmetic = TypeInfo<Scalar>::supportsArithmetic;
 			static constexpr bool supportsLogical	 = TypeInfo<Scalar>::supportsLogical;
@@ -110,25 +122,124 @@ namespace librapid {
 		// Descriptor is defined in "forward.hpp"
 
 		template<typename Packet, typename T>
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetExtractor(const T &obj, size_t index) {
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		convertPacket(const T &obj, size_t index, const BroadcastIndexer *broadcast);
+
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		packetExtractor(const T &obj, size_t index, const BroadcastIndexer *broadcast = nullptr) {
 			if constexpr (detail::IsArrayType<T>::val) {
-				static_assert(std::is_same_v<Packet, decltype(obj.packet(index))>,
-							  "Packet types do not match");
-				return obj.packet(index);
+				using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+				if constexpr (std::is_same_v<Scalar, typename Packet::value_type>) {
+					static_assert(std::is_same_v<Packet, decltype(obj.packet(index))>,
+								  "Packet types do not match");
+					if (broadcast != nullptr) LIBRAPID_UNLIKELY {
+							return broadcast->template packet<Packet>(obj, index);
+						}
+					return obj.packet(index);
+				} else {
+					return convertPacket<Packet>(obj, index, broadcast);
+				}
 			} else {
 				return Packet(obj);
 			}
 		}
 
 		template<typename T>
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalarExtractor(const T &obj, size_t index) {
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+		scalarExtractor(const T &obj, size_t index, const BroadcastIndexer *broadcast = nullptr) {
 			if constexpr(detail::IsArrayType<T>::val) {
+				if (broadcast != nullptr) LIBRAPID_UNLIKELY {
+						return broadcast->scalar(obj, index);
+					}
 				return obj.scalar(index);
 			} else {
 				return obj;
 			}
 		}
 
+		/// Load a packet from an operand with a different scalar type to the packet, converting
+		/// each element. If the two types have the same number of lanes (e.g. int32_t and float),
+		/// the operand's own packet is loaded and converted in registers. Otherwise, the
+		/// elements are read with a single converting (widening or narrowing) load -- directly
+		/// from memory for contiguous host arrays, and via a small buffer for everything else.
+		/// \tparam Packet The packet type to return
+		/// \tparam T The type of the operand
+		/// \param obj The operand
+		/// \param index The index of the first element to load
+		/// \param broadcast Index mapping for broadcast operands (may be null)
+		/// \return The converted packet
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		convertPacket(const T &obj, size_t index, const BroadcastIndexer *broadcast) {
+			using Scalar	 = typename Packet::value_type;
+			using ArgScalar	 = typename typetraits::TypeInfo<T>::Scalar;
+			using ArgPacket	 = typename typetraits::TypeInfo<ArgScalar>::Packet;
+			using ArgStorage = typename typetraits::TypeInfo<T>::StorageType;
+
+			if constexpr (ArgPacket::size == Packet::size) {
+				return xsimd::batch_cast<Scalar>(packetExtractor<ArgPacket>(obj, index, broadcast));
+			} else {
+				if constexpr (typetraits::IsArrayContainer<T>::value &&
+							  std::is_same_v<ArgStorage, Storage<ArgScalar>>) {
+					if (broadcast == nullptr) LIBRAPID_LIKELY {
+							return Packet::load_unaligned(obj.storage().begin() + index);
+						}
+				}
+
+				ArgScalar buffer[Packet::size];
+				for (size_t lane = 0; lane < Packet::size; ++lane) {
+					buffer[lane] = scalarExtractor(obj, index + lane, broadcast);
+				}
+				return Packet::load_unaligned(buffer);
+			}
+		}
+
+		/// Evaluates as true if the input type is an elementwise multiplication
+		/// \tparam T Input type
+		template<typename T>
+		struct IsMultiplyFunction : std::false_type {};
+
+		template<typename... Args>
+		struct IsMultiplyFunction<Function<descriptor::Trivial, Multiply, Args...>>
+				: std::true_type {};
+
+		/// Evaluates as true if the input type is an elementwise comparison, which can produce a
+		/// mask packet directly
+		/// \tparam T Input type
+		template<typename T>
+		struct IsComparisonFunction : std::false_type {};
+
+		template<typename Functor_, typename... Args>
+			requires(std::is_same_v<Functor_, LessThan> || std::is_same_v<Functor_, GreaterThan> ||
+					 std::is_same_v<Functor_, LessThanEqual> ||
+					 std::is_same_v<Functor_, GreaterThanEqual> ||
+					 std::is_same_v<Functor_, ElementWiseEqual> ||
+					 std::is_same_v<Functor_, ElementWiseNotEqual>)
+		struct IsComparisonFunction<Function<descriptor::Trivial, Functor_, Args...>>
+				: std::true_type {};
+
+		/// Identifies addition and subtraction operations with a multiplication as one of their
+		/// operands. These can be contracted into a single fused multiply-add, which is both
+		/// faster and more accurate than a separate multiplication and addition.
+		/// \tparam Functor The functor of the outer operation
+		/// \tparam Args The argument types of the outer operation
+		template<typename Functor, typename... Args>
+		struct FmaContraction {
+			static constexpr bool value = false;
+		};
+
+		template<typename Functor, typename LHS, typename RHS>
+			requires(std::is_same_v<Functor, Plus> || std::is_same_v<Functor, Minus>)
+		struct FmaContraction<Functor, LHS, RHS> {
+			static constexpr bool lhsIsMultiply = IsMultiplyFunction<std::decay_t<LHS>>::value;
+			static constexpr bool rhsIsMultiply = IsMultiplyFunction<std::decay_t<RHS>>::value;
+
+			static constexpr bool value			  = lhsIsMultiply || rhsIsMultiply;
+			static constexpr size_t multiplyIndex = lhsIsMultiply ? 0 : 1; // The multiplication
+			static constexpr size_t addendIndex	  = 1 - multiplyIndex;	   // The other operand
+		};
+
 		template<typename First, typename... Rest>
 		constexpr auto scalarTypesAreSame() {
 			if constexpr (sizeof...(Rest) == 0) {
@@ -215,6 +326,28 @@ namespace librapid {
 			/// \return The result of the function (scalar).
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalar(size_t index) const;
 
+			/// Evaluates a single argument of the function at the given index, returning a Packet
+			/// result. Intended for internal use only.
+			/// \tparam I The index of the argument.
+			/// \param index The index to evaluate at.
+			/// \return The argument's value (vectorized).
+			template<size_t I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet argPacket(size_t index) const;
+
+			/// Evaluates a single argument of the function at the given index, returning a Scalar
+			/// result. Intended for internal use only.
+			/// \tparam I The index of the argument.
+			/// \param index The index to evaluate at.
+			/// \return The argument's value (scalar).
+			template<size_t I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto argScalar(size_t index) const;
+
+			/// Evaluates a comparison at the given index, returning a mask rather than a Packet
+			/// of zeros and ones. Only valid for elementwise comparisons.
+			/// \param index The index to evaluate at.
+			/// \return The result of the comparison (as an xsimd::batch_bool).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mask(size_t index) const;
+
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator begin() const;
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Iterator end() const;
 
@@ -223,6 +356,44 @@ namespace librapid {
 					 const char (&formatString)[N], Ctx &ctx) const;
 
 		private:
+			using Contraction = FmaContraction<Functor, Args...>;
+
+			// Multiply-add contraction is only applied to floating point types, when the target
+			// has fused multiply-add instructions, and when the multiplication has the same
+			// scalar type as the result. Without hardware support, xsimd::fma is a separate
+			// multiplication and addition while std::fma is emulated in software, so neither
+			// path contracts and packets and scalars round in the same way.
+			static constexpr bool contractFma = []() {
+#if defined(LIBRAPID_HAS_FMA)
+				if constexpr (Contraction::value) {
+					using Multiplication =
+					  std::decay_t<std::tuple_element_t<Contraction::multiplyIndex,
+														std::tuple<Args...>>>;
+					return std::is_floating_point_v<Scalar> &&
+						   std::is_same_v<typename Multiplication::Scalar, Scalar>;
+				} else {
+					return false;
+				}
+#else
+				return false;
+#endif
+			}();
+
+			// A comparison used as the condition of a selection can provide its mask directly,
+			// provided it compares values of the same type as the result
+			static constexpr bool selectMask = []() {
+				if constexpr (std::is_same_v<Functor, Select> && sizeof...(Args) == 3) {
+					using Condition = std::decay_t<std::tuple_element_t<0, std::tuple<Args...>>>;
+					if constexpr (IsComparisonFunction<Condition>::value) {
+						return std::is_same_v<typename Condition::Scalar, Scalar>;
+					} else {
+						return false;
+					}
+				} else {
+					return false;
+				}
+			}();
+
 			/// Implementation detail -- evaluates the function at the given index,
 			/// returning a Packet result.
 			/// \tparam I The index sequence.
@@ -241,10 +412,31 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalarImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- creates a BroadcastIndexer for each array argument whose
+			/// shape differs from the shape of the result.
+			/// \tparam I The index sequence.
+			template<size_t... I>
+			LIBRAPID_ALWAYS_INLINE void initBroadcast(std::index_sequence<I...>);
+
 			Functor m_functor;
 			std::tuple<Args...> m_args;
 			ShapeType m_shape;
 			size_t m_size = 0;
+
+			/// Implementation detail -- returns the index mapping for argument \p I, or null if
+			/// the argument is not broadcast
+			/// \tparam I The index of the argument
+			template<size_t I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto broadcast() const
+			  -> const BroadcastIndexer *;
+
+			using BroadcastIndexers = std::array<std::optional<BroadcastIndexer>, sizeof...(Args)>;
+
+			// Index mappings for broadcast arguments, which are empty for arguments with the same
+			// shape as the result. They are only allocated if at least one argument is broadcast,
+			// which is rare, so every other expression only stores a null pointer. The mappings
+			// never change once created, so copies of an expression share them.
+			std::shared_ptr<const BroadcastIndexers> m_broadcast;
 		};
 
 		template<typename desc, typename Functor, typename... Args>
@@ -252,7 +444,38 @@ namespace librapid {
 																		  Args &&...args) :
 				m_functor(std::forward<Functor>(functor)),
 				m_args(std::forward<Args>(args)...),
-				m_shape(typetraits::TypeInfo<Functor>::getShape(m_args)), m_size(m_shape.size()) {}
+				m_shape(typetraits::TypeInfo<Functor>::getShape(m_args)), m_size(m_shape.size()) {
+			initBroadcast(std::make_index_sequence<sizeof...(Args)>());
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		LIBRAPID_ALWAYS_INLINE void
+		Function<desc, Functor, Args...>::initBroadcast(std::index_sequence<I...>) {
+			std::shared_ptr<BroadcastIndexers> indexers;
+
+			auto init = [&]<size_t Index>(std::integral_constant<size_t, Index>) {
+				const auto &arg = std::get<Index>(m_args);
+				if constexpr (detail::IsArrayType<std::decay_t<decltype(arg)>>::val) {
+					if (!(arg.shape() == m_shape)) LIBRAPID_UNLIKELY {
+							if (!indexers) indexers = std::make_shared<BroadcastIndexers>();
+							(*indexers)[Index].emplace(m_shape, arg.shape());
+						}
+				}
+			};
+
+			(init(std::integral_constant<size_t, I>()), ...);
+			m_broadcast = std::move(indexers);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t I>
+		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::broadcast() const
+		  -> const BroadcastIndexer * {
+			if (m_broadcast == nullptr) LIBRAPID_LIKELY { return nullptr; }
+			const auto &indexer = (*m_broadcast)[I];
+			return indexer.has_value() ? &*indexer : nullptr;
+		}
 
 		template<typename desc, typename Functor, typename... Args>
 		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::shape() const
@@ -291,6 +514,35 @@ namespace librapid {
 		template<typename desc, typename Functor, typename... Args>
 		typename Function<desc, Functor, Args...>::Packet LIBRAPID_ALWAYS_INLINE
 		Function<desc, Functor, Args...>::packet(size_t index) const {
+			if constexpr (contractFma) {
+				constexpr size_t multiplyIndex = Contraction::multiplyIndex;
+				constexpr size_t addendIndex   = Contraction::addendIndex;
+
+				// A broadcast multiplication must be evaluated at a different index
+				if (broadcast<multiplyIndex>() == nullptr) LIBRAPID_LIKELY {
+						const auto &multiply = std::get<multiplyIndex>(m_args);
+						const Packet a		 = multiply.template argPacket<0>(index);
+						const Packet b		 = multiply.template argPacket<1>(index);
+						const Packet c		 = argPacket<addendIndex>(index);
+
+						if constexpr (std::is_same_v<Functor, Plus>) {
+							return xsimd::fma(a, b, c); // a * b + c
+						} else if constexpr (multiplyIndex == 0) {
+							return xsimd::fms(a, b, c); // a * b - c
+						} else {
+							return xsimd::fnma(a, b, c); // c - a * b
+						}
+					}
+			}
+
+			if constexpr (selectMask) {
+				if (broadcast<0>() == nullptr) LIBRAPID_LIKELY {
+						return m_functor.packetMasked(std::get<0>(m_args).mask(index),
+													  argPacket<1>(index),
+													  argPacket<2>(index));
+					}
+			}
+
 			return packetImpl(std::make_index_sequence<sizeof...(Args)>(), index);
 		}
 
@@ -299,21 +551,62 @@ namespace librapid {
 		LIBRAPID_ALWAYS_INLINE auto
 		Function<desc, Functor, Args...>::packetImpl(std::index_sequence<I...>, size_t index) const
 		  -> Packet {
-			return m_functor.packet(packetExtractor<Packet>(std::get<I>(m_args), index)...);
+			return m_functor.packet(
+			  packetExtractor<Packet>(std::get<I>(m_args), index, broadcast<I>())...);
 		}
 
 		template<typename desc, typename Functor, typename... Args>
 		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::scalar(size_t index) const
 		  -> Scalar {
+			if constexpr (contractFma) {
+				constexpr size_t multiplyIndex = Contraction::multiplyIndex;
+				constexpr size_t addendIndex   = Contraction::addendIndex;
+
+				if (broadcast<multiplyIndex>() == nullptr) LIBRAPID_LIKELY {
+						const auto &multiply = std::get<multiplyIndex>(m_args);
+						const auto a = static_cast<Scalar>(multiply.template argScalar<0>(index));
+						const auto b = static_cast<Scalar>(multiply.template argScalar<1>(index));
+						const auto c = static_cast<Scalar>(argScalar<addendIndex>(index));
+
+						if constexpr (std::is_same_v<Functor, Plus>) {
+							return std::fma(a, b, c);
+						} else if constexpr (multiplyIndex == 0) {
+							return std::fma(a, b, -c);
+						} else {
+							return std::fma(-a, b, c);
+						}
+					}
+			}
+
 			return scalarImpl(std::make_index_sequence<sizeof...(Args)>(), index);
 		}
 
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t I>
+		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::argPacket(size_t index) const
+		  -> Packet {
+			return packetExtractor<Packet>(std::get<I>(m_args), index, broadcast<I>());
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t I>
+		LIBRAPID_ALWAYS_INLINE auto
+		Function<desc, Functor, Args...>::argScalar(size_t index) const {
+			return scalarExtractor(std::get<I>(m_args), index, broadcast<I>());
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::mask(size_t index) const {
+			static_assert(sizeof...(Args) == 2, "Masks can only be produced by comparisons");
+			return m_functor.mask(argPacket<0>(index), argPacket<1>(index));
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		template<size_t... I>
 		LIBRAPID_ALWAYS_INLINE auto
 		Function<desc, Functor, Args...>::scalarImpl(std::index_sequence<I...>, size_t index) const
 		  -> Scalar {
-			return m_functor(scalarExtractor(std::get<I>(m_args), index)...);
+			return m_functor(scalarExtractor(std::get<I>(m_args), index, broadcast<I>())...);
 		}
 
 		template<typename desc, typename Functor, typename... Args>
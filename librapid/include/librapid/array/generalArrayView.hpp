@@ -11,7 +11,13 @@ namespace librapid {
 			using ArrayViewType = std::decay_t<T>;
 			using ShapeType		= typename TypeInfo<ArrayViewType>::ShapeType;
 			using StorageType	= typename TypeInfo<ArrayViewType>::StorageType;
-			static constexpr bool allowVectorisation = false;
+
+			// Views of CPU arrays can be loaded packet-by-packet, even though the data is not
+			// necessarily contiguous. Views of anything else are evaluated one scalar at a time.
+			static constexpr bool allowVectorisation =
+			  TypeInfo<ArrayViewType>::type == detail::LibRapidType::ArrayContainer &&
+			  std::is_same_v<Backend, backend::CPU> && TypeInfo<Scalar>::allowVectorisation &&
+			  TypeInfo<Scalar>::packetWidth > 1;
 		};
 
 		LIBRAPID_DEFINE_AS_TYPE(typename T COMMA typename S, array::GeneralArrayView<T COMMA S>);
@@ -43,6 +49,7 @@ namespace librapid {
 			using StorageType	 = typename typetraits::TypeInfo<BaseType>::StorageType;
 			using ArrayType		 = array::ArrayContainer<ShapeType, StorageType>;
 			using Iterator		 = detail::ArrayIterator<GeneralArrayView>;
+			using Packet		 = typename typetraits::TypeInfo<Scalar>::Packet;
 
 			/// Default constructor should never be used
 			GeneralArrayView() = delete;
@@ -93,10 +100,11 @@ namespace librapid {
 			operator=(const array::Transpose<TransposeType> &transpose);
 
 			template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-					 typename StorageTypeB, typename Alpha, typename Beta>
+					 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 			LIBRAPID_ALWAYS_INLINE GeneralArrayView &
 			operator=(const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB,
-												  StorageTypeB, Alpha, Beta> &matmul);
+												  StorageTypeB, Alpha, Beta, TransA,
+												  TransB> &matmul);
 
 			/// Access a sub-array of this ArrayView.
 			/// \param index The index of the sub-array.
@@ -156,6 +164,19 @@ namespace librapid {
 			/// \return Scalar at the given index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalar(int64_t index) const;
 
+			/// Return a Packet starting at a given index in this ArrayView. If every element of
+			/// the packet lies in the same row of the innermost dimension, the elements are loaded
+			/// directly (when the row is contiguous) or gathered with the row's stride. Otherwise,
+			/// each element is loaded individually. This is only available for views of CPU
+			/// arrays.
+			/// \param index The index of the first element of the packet
+			/// \return Packet starting at the given index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(int64_t index) const;
+
+			/// Return the array referenced by this ArrayView. Intended for internal use only.
+			/// \return The referenced array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const BaseType &base() const;
+
 			template<typename T>
 			LIBRAPID_ALWAYS_INLINE GeneralArrayView &operator+=(const T &other);
 
@@ -182,6 +203,35 @@ namespace librapid {
 					 const char (&formatString)[N], Ctx &ctx) const;
 
 		private:
+			/// Convert an index into this ArrayView into an offset into the referenced array
+			/// (excluding the offset of the view itself)
+			/// \param index The index to convert
+			/// \return The offset of the element in the referenced array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t indexToOffset(int64_t index) const;
+
+			/// Copy elements into this ArrayView from memory laid out with the strides
+			/// \p srcStride. The innermost dimensions which are contiguous in both this view and
+			/// the source are collapsed into a single run, which is copied with one memmove, so
+			/// the index arithmetic is done once per run rather than once per element. If even
+			/// the innermost dimension is strided, it is still copied in a tight loop.
+			///
+			/// The source may overlap this view (e.g. when shifting part of an array along
+			/// itself). If the destination lies after the source, the runs are copied from last to
+			/// first, so no element is overwritten before it has been read.
+			/// \tparam SrcStride The stride type of the source
+			/// \param src Pointer to the first element of the source
+			/// \param srcStride The strides of the source, in elements
+			template<typename SrcStride>
+			LIBRAPID_ALWAYS_INLINE void copyStrided(const Scalar *src, const SrcStride &srcStride);
+
+			/// Write the value of every element of \p source into this ArrayView. Each row of the
+			/// innermost dimension is written through a single pointer, in packets when the row
+			/// is contiguous and \p source supports them.
+			/// \tparam Source The type of the object being assigned
+			/// \param source The object being assigned, with the same shape as this view
+			template<typename Source>
+			LIBRAPID_ALWAYS_INLINE void evaluateStrided(const Source &source);
+
 			ArrayViewType m_ref;
 			ShapeType m_shape;
 			StrideType m_stride;
@@ -200,7 +250,7 @@ namespace librapid {
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::GeneralArrayView(
 		  const GeneralArrayView &other) :
 				m_ref(other.m_ref),
-				m_shape(other.m_shape), m_stride(other.m_stride) {}
+				m_shape(other.m_shape), m_stride(other.m_stride), m_offset(other.m_offset) {}
 
 		template<typename ArrayViewType, typename ArrayViewShapeType>
 		LIBRAPID_ALWAYS_INLINE
@@ -230,6 +280,14 @@ namespace librapid {
 										   m_shape,
 										   other.shape());
 
+			if constexpr (std::is_same_v<StorageType, Storage<Scalar>>) {
+				if (m_shape.size() == 0) return *this;
+				// Read the source through const storage, so a shared source is not copied first
+				copyStrided(std::as_const(other.base()).storage().data() + other.offset(),
+							other.stride());
+				return *this;
+			}
+
 			ShapeType coord = ShapeType::zeros(m_shape.ndim());
 			int64_t d = 0, p = 0;
 			int64_t idim = 0, adim = 0;
@@ -264,6 +322,14 @@ namespace librapid {
 										   m_shape,
 										   other.shape());
 
+			if constexpr (std::is_same_v<StorageType, Storage<Scalar>> &&
+						  std::is_same_v<StorageType_, Storage<Scalar>>) {
+				if (m_shape.size() == 0) return *this;
+				copyStrided(std::as_const(other).storage().data(),
+							Stride<ShapeType_>(other.shape()));
+				return *this;
+			}
+
 			ShapeType coord = ShapeType::zeros(m_shape.ndim());
 			int64_t d = 0, p = 0;
 			int64_t idim = 0, adim = 0;
@@ -297,6 +363,13 @@ namespace librapid {
 										   m_shape,
 										   function.shape());
 
+			if constexpr (std::is_same_v<StorageType, Storage<Scalar>> &&
+						  std::is_same_v<typename detail::Function<desc, Functor, Args...>::Backend,
+										 backend::CPU>) {
+				evaluateStrided(function);
+				return *this;
+			}
+
 			ShapeType coord = ShapeType::zeros(m_shape.ndim());
 			int64_t d = 0, p = 0;
 			int64_t idim = 0, adim = 0;
@@ -355,10 +428,10 @@ namespace librapid {
 
 		template<typename ArrayViewType, typename ArrayViewShapeType>
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 		LIBRAPID_ALWAYS_INLINE auto GeneralArrayView<ArrayViewType, ArrayViewShapeType>::operator=(
 		  const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-									  Beta> &matmul) -> GeneralArrayView & {
+									  Beta, TransA, TransB> &matmul) -> GeneralArrayView & {
 			LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
 										   m_shape.operator==(matmul.shape()),
 										   "GeneralArrayView assignment shape mismatch. {} vs {}",
@@ -499,16 +572,202 @@ namespace librapid {
 		LIBRAPID_ALWAYS_INLINE auto
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::scalar(int64_t index) const -> auto {
 			if (ndim() == 0) return m_ref.scalar(m_offset);
+			return m_ref.scalar(m_offset + indexToOffset(index));
+		}
+
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		LIBRAPID_ALWAYS_INLINE auto
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::packet(int64_t index) const
+		  -> Packet {
+			static_assert(typetraits::TypeInfo<GeneralArrayView>::allowVectorisation,
+						  "Packet loads are only supported for views of CPU arrays");
+
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			const int64_t dims			  = ndim();
+
+			// A zero-dimensional view holds a single value
+			if (dims == 0) return Packet(static_cast<Scalar>(scalar(0)));
 
-			ShapeType tmp	= ShapeType::zeros(ndim());
-			tmp[ndim() - 1] = index % m_shape[ndim() - 1];
-			for (int64_t i = ndim() - 2; i >= 0; --i) {
-				index /= m_shape[i + 1];
-				tmp[i] = index % m_shape[i];
+			const int64_t innerExtent = m_shape[dims - 1];
+			const int64_t innerStride = m_stride[dims - 1];
+
+			if ((index % innerExtent) + packetWidth <= innerExtent) LIBRAPID_LIKELY {
+					const Scalar *first =
+					  base().storage().data() + m_offset + indexToOffset(index);
+					if (innerStride == 1) return xsimd::load_unaligned(first);
+					return detail::gatherStrided<Packet>(first, innerStride);
+				}
+
+			// The packet spans multiple rows
+			alignas(LIBRAPID_MEM_ALIGN) Scalar buffer[packetWidth];
+			for (int64_t lane = 0; lane < packetWidth; ++lane) {
+				buffer[lane] = scalar(index + lane);
 			}
+			return xsimd::load_aligned(buffer);
+		}
+
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		LIBRAPID_ALWAYS_INLINE auto
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::base() const -> const BaseType & {
+			return m_ref;
+		}
+
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		LIBRAPID_ALWAYS_INLINE auto
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::indexToOffset(int64_t index) const
+		  -> int64_t {
 			int64_t offset = 0;
-			for (int64_t i = 0; i < ndim(); ++i) { offset += tmp[i] * m_stride[i]; }
-			return m_ref.scalar(m_offset + offset);
+			for (int64_t i = ndim() - 1; i >= 0; --i) {
+				offset += (index % static_cast<int64_t>(m_shape[i])) * m_stride[i];
+				index /= static_cast<int64_t>(m_shape[i]);
+			}
+			return offset;
+		}
+
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		template<typename SrcStride>
+		LIBRAPID_ALWAYS_INLINE void
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::copyStrided(
+		  const Scalar *src, const SrcStride &srcStride) {
+			const int64_t dims = ndim();
+			auto extent		   = [&](int64_t dim) { return static_cast<int64_t>(m_shape[dim]); };
+			auto dstStride	   = [&](int64_t dim) { return static_cast<int64_t>(m_stride[dim]); };
+			auto fromStride	   = [&](int64_t dim) { return static_cast<int64_t>(srcStride[dim]); };
+
+			// Collapse the innermost dimensions which are contiguous in both arrays. Dimensions
+			// [inner, dims) are then copied as a single run of elements.
+			int64_t inner = dims;
+			int64_t run	  = 1;
+			while (inner > 0 && dstStride(inner - 1) == run && fromStride(inner - 1) == run) {
+				run *= extent(inner - 1);
+				--inner;
+			}
+
+			int64_t dstStep = 1, srcStep = 1;
+			if (inner == dims && dims > 0) {
+				--inner;
+				run		= extent(inner);
+				dstStep = dstStride(inner);
+				srcStep = fromStride(inner);
+			}
+
+			// Writing through the non-const storage separates it from any copies first
+			Scalar *dst = m_ref.storage().data() + m_offset;
+
+			// Copy backwards if the destination starts after the source, in case they overlap
+			const bool backward = std::less<const Scalar *>()(src, dst);
+
+			ShapeType coord = ShapeType::zeros(inner);
+			int64_t dstOffset = 0, srcOffset = 0;
+			int64_t idim = 0;
+
+			if (backward) {
+				for (int64_t dim = 0; dim < inner; ++dim) {
+					coord[dim] = m_shape[dim] - 1;
+					dstOffset += (extent(dim) - 1) * dstStride(dim);
+					srcOffset += (extent(dim) - 1) * fromStride(dim);
+				}
+			}
+
+			do {
+				Scalar *to		   = dst + dstOffset;
+				const Scalar *from = src + srcOffset;
+
+				if (dstStep == 1 && srcStep == 1) {
+					if constexpr (std::is_trivially_copyable_v<Scalar>) {
+						// memmove handles any overlap within the run itself
+						std::memmove(to, from, static_cast<size_t>(run) * sizeof(Scalar));
+					} else if (backward) {
+						for (int64_t i = run - 1; i >= 0; --i) to[i] = from[i];
+					} else {
+						for (int64_t i = 0; i < run; ++i) to[i] = from[i];
+					}
+				} else if (backward) {
+					for (int64_t i = run - 1; i >= 0; --i) to[i * dstStep] = from[i * srcStep];
+				} else {
+					for (int64_t i = 0; i < run; ++i) to[i * dstStep] = from[i * srcStep];
+				}
+
+				if (backward) {
+					for (idim = inner - 1; idim >= 0; --idim) {
+						if (coord[idim] == 0) {
+							coord[idim] = m_shape[idim] - 1;
+							dstOffset += (extent(idim) - 1) * dstStride(idim);
+							srcOffset += (extent(idim) - 1) * fromStride(idim);
+						} else {
+							--coord[idim];
+							dstOffset -= dstStride(idim);
+							srcOffset -= fromStride(idim);
+							break;
+						}
+					}
+				} else {
+					for (idim = inner - 1; idim >= 0; --idim) {
+						if (++coord[idim] == m_shape[idim]) {
+							coord[idim] = 0;
+							dstOffset -= (extent(idim) - 1) * dstStride(idim);
+							srcOffset -= (extent(idim) - 1) * fromStride(idim);
+						} else {
+							dstOffset += dstStride(idim);
+							srcOffset += fromStride(idim);
+							break;
+						}
+					}
+				}
+			} while (idim >= 0);
+		}
+
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		template<typename Source>
+		LIBRAPID_ALWAYS_INLINE void
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::evaluateStrided(const Source &source) {
+			constexpr bool vectorise = typetraits::TypeInfo<Source>::allowVectorisation &&
+									   std::is_same_v<typename Source::Scalar, Scalar> &&
+									   typetraits::TypeInfo<Scalar>::packetWidth > 1;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			// Writing through the non-const storage separates it from any copies, so do it once
+			Scalar *dst		   = m_ref.storage().data() + m_offset;
+			const int64_t dims = ndim();
+
+			if (dims == 0) {
+				dst[0] = static_cast<Scalar>(source.scalar(0));
+				return;
+			}
+
+			const int64_t run	   = m_shape[dims - 1];
+			const int64_t runCount =
+			  static_cast<int64_t>(m_shape.size()) / std::max<int64_t>(run, 1);
+			const int64_t step	   = m_stride[dims - 1];
+
+			ShapeType coord	  = ShapeType::zeros(dims - 1);
+			int64_t dstOffset = 0;
+
+			for (int64_t r = 0; r < runCount; ++r) {
+				Scalar *to			= dst + dstOffset;
+				const int64_t first = r * run;
+				int64_t i			= 0;
+
+				if constexpr (vectorise) {
+					if (step == 1) {
+						for (; i + packetWidth <= run; i += packetWidth) {
+							source.packet(first + i).store_unaligned(to + i);
+						}
+					}
+				}
+
+				for (; i < run; ++i) to[i * step] = static_cast<Scalar>(source.scalar(first + i));
+
+				for (int64_t idim = dims - 2; idim >= 0; --idim) {
+					if (++coord[idim] == m_shape[idim]) {
+						coord[idim] = 0;
+						dstOffset -= (static_cast<int64_t>(m_shape[idim]) - 1) * m_stride[idim];
+					} else {
+						dstOffset += m_stride[idim];
+						break;
+					}
+				}
+			}
 		}
 
 		template<typename ArrayViewType, typename ArrayViewShapeType>
@@ -547,25 +806,30 @@ namespace librapid {
 		LIBRAPID_ALWAYS_INLINE auto
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::eval() const -> ArrayType {
 			ArrayType res(m_shape);
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
 
-			do {
-				res.storage()[d++] = m_ref.scalar(p + m_offset);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
+			if constexpr (std::is_same_v<StorageType, Storage<Scalar>>) {
+				detail::assign(res, *this);
+			} else {
+				ShapeType coord = ShapeType::zeros(m_shape.ndim());
+				int64_t d = 0, p = 0;
+				int64_t idim = 0, adim = 0;
+				const int64_t ndim = m_shape.ndim();
+
+				do {
+					res.storage()[d++] = m_ref.scalar(p + m_offset);
+
+					for (idim = 0; idim < ndim; ++idim) {
+						adim = ndim - idim - 1;
+						if (++coord[adim] == m_shape[adim]) {
+							coord[adim] = 0;
+							p			= p - (m_shape[adim] - 1) * m_stride[adim];
+						} else {
+							p = p + m_stride[adim];
+							break;
+						}
 					}
-				}
-			} while (idim < ndim);
+				} while (idim < ndim);
+			}
 
 			return res;
 		}
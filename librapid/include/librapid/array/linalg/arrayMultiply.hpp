@@ -27,10 +27,11 @@ namespace librapid {
 
 	namespace linalg {
 		enum class MatmulClass {
-			DOT,   // Vector-vector dot product
-			GEMV,  // Matrix-vector product
-			GEMM,  // Matrix-matrix product
-			OUTER, // Outer product
+			DOT,		  // Vector-vector dot product
+			GEMV,		  // Matrix-vector product
+			GEMM,		  // Matrix-matrix product
+			BATCHED_GEMM, // Matrix-matrix products over a batch of matrices
+			OUTER,		  // Outer product
 		};
 
 		/// Class to represent an array multiplication (vector-vector, matrix-vector, matrix-matrix)
@@ -40,8 +41,10 @@ namespace librapid {
 		/// \tparam StorageTypeB Storage type of the second array
 		/// \tparam Alpha Type of \f$ \alpha \f$ scaling factor
 		/// \tparam Beta Type of \f$ \beta \f$ scaling factor
+		/// \tparam TransA Transpose flag of the first array, if both arrays are fixed-size
+		/// \tparam TransB Transpose flag of the second array, if both arrays are fixed-size
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 		class ArrayMultiply {
 		public:
 			using TypeA		= array::ArrayContainer<ShapeTypeA, StorageTypeA>;
@@ -56,6 +59,11 @@ namespace librapid {
 
 			static_assert(std::is_same_v<Backend, BackendB>, "Backend of A and B must match");
 
+			/// Describes the product if both arrays are fixed-size, in which case the transpose
+			/// flags are known at compile time
+			using FixedProduct =
+			  typetraits::FixedProductInfo<StorageTypeA, StorageTypeB, TransA, TransB>;
+
 			/// Default constructor (deleted)
 			ArrayMultiply() = delete;
 
@@ -98,11 +106,17 @@ namespace librapid {
 			/// \brief Determine the class of the array multiplication
 			///
 			/// The class of the array multiplication is determined by the shapes of the arrays.
-			/// There are three supported cases:
+			/// There are five supported cases:
 			/// - Vector-vector dot product (both arrays are 1-dimensional vectors)
 			/// - Matrix-vector product (first array is a 2-dimensional matrix, second array is a
 			/// 1-dimensional vector)
+			/// - Outer product (a 2-dimensional column, of shape [m, 1], multiplied by a
+			/// 2-dimensional row, of shape [1, n], after applying the transpose flags)
 			/// - Matrix-matrix product (both arrays are 2-dimensional matrices)
+			/// - Batched matrix-matrix product (a 3-dimensional array of shape [batch, m, k]
+			/// multiplied by one of shape [batch, k, n]). Either array may instead be a
+			/// 2-dimensional matrix, which is used for every product in the batch. The transpose
+			/// flags transpose each matrix in the batch.
 			/// \return Class of the array multiplication
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE MatmulClass matmulClass() const;
 
@@ -119,8 +133,40 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t ndim() const;
 
 			/// \brief Force evaluation of the array multiplication, returning an Array object
+			/// \tparam Epilogue Type of the epilogue
+			/// \param epilogue Element-wise epilogue to apply to the result (see withEpilogue)
 			/// \return Array object containing the result
-			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const;
+			template<typename Epilogue = NoEpilogue>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			eval(const Epilogue &epilogue = Epilogue()) const;
+
+			/// \brief Fuse an element-wise epilogue into the array multiplication
+			///
+			/// The epilogue is called as `epilogue(value, row, col)` for each element of the
+			/// result, and returns the final value of that element. It is applied while the
+			/// result is being computed, rather than in separate passes over it afterwards, so
+			/// the forward pass of a dense layer can be written as
+			///
+			/// \code{.cpp}
+			/// lrc::Array<float> out = lrc::dot(x, weights).withEpilogue(
+			///   [&](float value, int64_t, int64_t col) {
+			///     return std::max(value + bias.scalar(col), 0.0f);
+			///   });
+			/// \endcode
+			///
+			/// For a matrix-matrix product, the epilogue is applied to each tile of the result as
+			/// soon as it has been computed, on the same thread and while it is still in the
+			/// cache (see gemmEpilogue). For the other products, it is applied once the result
+			/// has been computed. A 1-dimensional result is treated as a single row, and the rows
+			/// of a batched product are numbered consecutively through the batch. An epilogue may
+			/// also provide a packet form, `epilogue.packet(value, row, col)`, which is used for
+			/// whole packets of the result (see epilogue.hpp). Epilogues are only supported on
+			/// the CPU.
+			/// \tparam Epilogue Type of the epilogue
+			/// \param epilogue The epilogue to apply
+			/// \return A FusedArrayMultiply object
+			template<typename Epilogue>
+			LIBRAPID_NODISCARD auto withEpilogue(Epilogue &&epilogue) const;
 
 			/// \brief Get the scaling factor \f$ \alpha \f$
 			/// \return \f$ \alpha \f$
@@ -162,9 +208,12 @@ namespace librapid {
 			/// shape. If the Array does not have the correct shape, an error is thrown.
 			///
 			/// \tparam StorageType Storage type of the array container
+			/// \tparam Epilogue Type of the epilogue
 			/// \param out Array container to store the result in
-			template<typename StorageType>
-			void applyTo(array::ArrayContainer<ShapeType, StorageType> &out) const;
+			/// \param epilogue Element-wise epilogue to apply to the result (see withEpilogue)
+			template<typename StorageType, typename Epilogue = NoEpilogue>
+			void applyTo(array::ArrayContainer<ShapeType, StorageType> &out,
+						 const Epilogue &epilogue = Epilogue()) const;
 
 			template<typename T, typename Char, size_t N, typename Ctx>
 			void str(const fmt::formatter<T, Char> &format, char bracket, char separator,
@@ -183,37 +232,47 @@ namespace librapid {
 		};
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-					  Beta>::ArrayMultiply(bool transA, bool transB, TypeA &&a, Alpha alpha,
-										   TypeB &&b, Beta beta) :
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+					  TransB>::ArrayMultiply(bool transA, bool transB, TypeA &&a, Alpha alpha,
+											 TypeB &&b, Beta beta) :
 				m_transA(transA),
 				m_transB(transB), m_a(std::forward<TypeA>(a)), m_alpha(static_cast<ScalarA>(alpha)),
 				m_b(std::forward<TypeB>(b)), m_beta(static_cast<ScalarB>(beta)),
-				m_shape(calculateShape()), m_size(m_shape.size()) {}
+				m_shape(calculateShape()), m_size(m_shape.size()) {
+			LIBRAPID_ASSERT(!FixedProduct::value ||
+							  (transA == FixedProduct::transA && transB == FixedProduct::transB),
+							"Transpose flags of fixed-size arrays must match the template "
+							"parameters");
+		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-					  Beta>::ArrayMultiply(TypeA &&a, TypeB &&b) :
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+					  TransB>::ArrayMultiply(TypeA &&a, TypeB &&b) :
 				m_transA(false),
 				m_transB(false), m_a(std::forward<TypeA>(a)), m_alpha(1),
 				m_b(std::forward<TypeB>(b)), m_beta(0), m_shape(calculateShape()),
 				m_size(m_shape.size()) {}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-					  Beta>::ArrayMultiply(bool transA, bool transB, TypeA &&a, TypeB &&b) :
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+					  TransB>::ArrayMultiply(bool transA, bool transB, TypeA &&a, TypeB &&b) :
 				m_transA(transA),
 				m_transB(transB), m_a(std::forward<TypeA>(a)), m_alpha(1),
 				m_b(std::forward<TypeB>(b)), m_beta(0), m_shape(calculateShape()),
-				m_size(m_shape.size()) {}
+				m_size(m_shape.size()) {
+			LIBRAPID_ASSERT(!FixedProduct::value ||
+							  (transA == FixedProduct::transA && transB == FixedProduct::transB),
+							"Transpose flags of fixed-size arrays must match the template "
+							"parameters");
+		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-						   Beta>::matmulClass() const -> MatmulClass {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::matmulClass() const -> MatmulClass {
 			const auto &shapeA = m_a.shape();
 			const auto &shapeB = m_b.shape();
 
@@ -268,7 +327,26 @@ namespace librapid {
 								m_a.shape()[int(!m_transA)],
 								m_b.shape()[int(m_transB)]);
 
+				// A column multiplied by a row has no sum to compute
+				if (shapeA[int(!m_transA)] == 1) return MatmulClass::OUTER;
+
 				return MatmulClass::GEMM;
+			} else if (std::max<int64_t>(shapeA.ndim(), shapeB.ndim()) == 3 &&
+					   std::min<int64_t>(shapeA.ndim(), shapeB.ndim()) >= 2) {
+				const int64_t offsetA = shapeA.ndim() - 2;
+				const int64_t offsetB = shapeB.ndim() - 2;
+
+				LIBRAPID_ASSERT(shapeA.ndim() == 2 || shapeB.ndim() == 2 || shapeA[0] == shapeB[0],
+								"Batch sizes must match. Expected: {} -- Got: {}",
+								shapeA[0],
+								shapeB[0]);
+
+				LIBRAPID_ASSERT(shapeA[offsetA + int(!m_transA)] == shapeB[offsetB + int(m_transB)],
+								"Inner dimensions of matrices must match. Expected: {} -- Got: {}",
+								shapeA[offsetA + int(!m_transA)],
+								shapeB[offsetB + int(m_transB)]);
+
+				return MatmulClass::BATCHED_GEMM;
 			} else {
 				LIBRAPID_NOT_IMPLEMENTED;
 
@@ -277,9 +355,9 @@ namespace librapid {
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
-						   Beta>::calculateShape() const -> ShapeType {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::calculateShape() const -> ShapeType {
 			const auto &shapeA		= m_a.shape();
 			const auto &shapeB		= m_b.shape();
 			MatmulClass matmulClass = this->matmulClass();
@@ -294,9 +372,16 @@ namespace librapid {
 				case MatmulClass::GEMM: {
 					return {shapeA[int(m_transA)], shapeB[int(!m_transB)]};
 				}
+				case MatmulClass::BATCHED_GEMM: {
+					const int64_t offsetA = shapeA.ndim() - 2;
+					const int64_t offsetB = shapeB.ndim() - 2;
+					const auto batch	  = shapeA.ndim() == 3 ? shapeA[0] : shapeB[0];
+					return {static_cast<int64_t>(batch),
+							static_cast<int64_t>(shapeA[offsetA + int(m_transA)]),
+							static_cast<int64_t>(shapeB[offsetB + int(!m_transB)])};
+				}
 				case MatmulClass::OUTER: {
-					LIBRAPID_NOT_IMPLEMENTED;
-					return {1};
+					return {shapeA[int(m_transA)], shapeB[int(!m_transB)]};
 				}
 			}
 
@@ -305,118 +390,188 @@ namespace librapid {
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::shape()
-		  const -> ShapeType {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::shape() const -> ShapeType {
 			return m_shape;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::size() const
-		  -> size_t {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::size() const -> size_t {
 			return m_size;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::ndim() const
-		  -> int64_t {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::ndim() const -> int64_t {
 			return shape().ndim();
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::eval()
-		  const {
-			Array<Scalar, Backend> result(shape());
-			applyTo(result);
-			return result;
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		template<typename Epilogue>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::eval(const Epilogue &epilogue) const {
+			if constexpr (FixedProduct::value) {
+				// The dimensions of a product of fixed-size arrays are known at compile time, so
+				// the result is fixed-size too, and is evaluated without allocating
+				using ResultStorage = typename FixedProduct::template Storage<Scalar>;
+				array::ArrayContainer<ShapeType, ResultStorage> result(shape(), ResultStorage());
+				applyTo(result, epilogue);
+				return result;
+			} else {
+				using ResultStorage =
+				  typename detail::TypeDefStorageEvaluator<Scalar, Backend>::Type;
+				array::ArrayContainer<ShapeType, ResultStorage> result(shape());
+				applyTo(result, epilogue);
+				return result;
+			}
+		}
+
+		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		template<typename Epilogue>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::withEpilogue(Epilogue &&epilogue) const {
+			return FusedArrayMultiply<ArrayMultiply, std::decay_t<Epilogue>>(
+			  *this, std::forward<Epilogue>(epilogue));
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::alpha()
-		  const -> ScalarA {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::alpha() const -> ScalarA {
 			return m_alpha;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::beta() const
-		  -> ScalarB {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::beta() const -> ScalarB {
 			return m_beta;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		bool
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::transA()
-		  const {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		bool ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::transA() const {
 			return m_transA;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		bool
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::transB()
-		  const {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		bool ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::transB() const {
 			return m_transB;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::a() const
-		  -> const TypeA & {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::a() const -> const TypeA & {
 			return m_a;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::b() const
-		  -> const TypeB & {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::b() const -> const TypeB & {
 			return m_b;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::a()
-		  -> TypeA & {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::a() -> TypeA & {
 			return m_a;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::b()
-		  -> TypeB & {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::b() -> TypeB & {
 			return m_b;
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		template<typename StorageType>
-		void
-		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::applyTo(
-		  array::ArrayContainer<ShapeType, StorageType> &out) const {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		template<typename StorageType, typename Epilogue>
+		void ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::applyTo(
+		  array::ArrayContainer<ShapeType, StorageType> &out, const Epilogue &epilogue) const {
+			static_assert(typetraits::IsNoEpilogue<Epilogue>::value ||
+							std::is_same_v<Backend, backend::CPU>,
+						  "Epilogues are only supported on the CPU");
+
 			LIBRAPID_ASSERT(out.shape() == shape(),
 							"Shape of output array must match shape of array multiply operation. "
 							"Expected: {} -- Got: {}",
 							shape(),
 							out.shape());
-			MatmulClass matmulClass = this->matmulClass();
 
 			auto a = detail::arrayPointerExtractor(m_a.storage().data());
 			auto b = detail::arrayPointerExtractor(m_b.storage().data());
 			auto c = detail::arrayPointerExtractor(out.storage().data());
 
+			// Apply the epilogue to the whole result, viewed as a row-major matrix. Matrix-matrix
+			// products apply it to one tile at a time instead
+			auto applyEpilogueToAll = [&](int64_t rows, int64_t cols) {
+				if constexpr (!typetraits::IsNoEpilogue<Epilogue>::value) {
+					detail::cpu::applyEpilogue(c, cols, int64_t(0), rows, cols, epilogue);
+				}
+			};
+
+			// Small fixed-size products are computed with a fully unrolled kernel, chosen at
+			// compile time. Mixed-type products are left to the general implementation
+			if constexpr (FixedProduct::value) {
+				constexpr size_t maxDim = detail::cpu::maxUnrolledDimension;
+
+				if constexpr (FixedProduct::rows <= maxDim && FixedProduct::cols <= maxDim &&
+							  FixedProduct::inner <= maxDim && std::is_same_v<ScalarA, Scalar> &&
+							  std::is_same_v<ScalarB, Scalar> &&
+							  std::is_same_v<typename StorageType::Scalar, Scalar>) {
+					detail::cpu::fixedGemm<FixedProduct::rows,
+										   FixedProduct::cols,
+										   FixedProduct::inner,
+										   FixedProduct::transA,
+										   FixedProduct::transB>(static_cast<Scalar>(m_alpha),
+																 a,
+																 b,
+																 static_cast<Scalar>(m_beta),
+																 c);
+
+					// A vector result is treated as a single row, as for the general kernels
+					if constexpr (FixedProduct::ndim == 1) {
+						applyEpilogueToAll(1, int64_t(FixedProduct::rows));
+					} else {
+						applyEpilogueToAll(int64_t(FixedProduct::rows),
+										   int64_t(FixedProduct::cols));
+					}
+					return;
+				}
+			}
+
+			MatmulClass matmulClass = this->matmulClass();
+
 			switch (matmulClass) {
 				case MatmulClass::DOT: {
-					LIBRAPID_NOT_IMPLEMENTED;
+					auto n = int64_t(m_a.shape()[0]);
+
+					dot(n,
+						static_cast<Scalar>(m_alpha),
+						a,
+						int64_t(1),
+						b,
+						int64_t(1),
+						static_cast<Scalar>(m_beta),
+						c,
+						Backend());
+
+					applyEpilogueToAll(1, 1);
+					break;
 				}
 				case MatmulClass::GEMV: {
 					auto m = int64_t(m_a.shape()[m_transA]);
@@ -439,6 +594,7 @@ namespace librapid {
 						 incC,
 						 Backend());
 
+					applyEpilogueToAll(1, m);
 					break;
 				}
 				case MatmulClass::GEMM: {
@@ -450,21 +606,107 @@ namespace librapid {
 					auto ldb = int64_t(m_b.shape()[1]);
 					auto ldc = int64_t(out.shape()[1]);
 
-					gemm(m_transA,
-						 m_transB,
-						 m,
-						 n,
-						 k,
-						 static_cast<Scalar>(m_alpha),
-						 a,
-						 lda,
-						 b,
-						 ldb,
-						 static_cast<Scalar>(m_beta),
-						 c,
-						 ldc,
-						 Backend());
+					if constexpr (typetraits::IsNoEpilogue<Epilogue>::value) {
+						gemm(m_transA,
+							 m_transB,
+							 m,
+							 n,
+							 k,
+							 static_cast<Scalar>(m_alpha),
+							 a,
+							 lda,
+							 b,
+							 ldb,
+							 static_cast<Scalar>(m_beta),
+							 c,
+							 ldc,
+							 Backend());
+					} else {
+						gemmEpilogue(m_transA,
+									 m_transB,
+									 m,
+									 n,
+									 k,
+									 static_cast<Scalar>(m_alpha),
+									 a,
+									 lda,
+									 b,
+									 ldb,
+									 static_cast<Scalar>(m_beta),
+									 c,
+									 ldc,
+									 epilogue,
+									 Backend());
+					}
+
+					break;
+				}
+				case MatmulClass::OUTER: {
+					// Both operands are contiguous vectors, whether or not they are transposed
+					auto m = int64_t(m_a.shape()[m_transA]);
+					auto n = int64_t(m_b.shape()[1 - m_transB]);
 
+					auto incA = int64_t(1);
+					auto incB = int64_t(1);
+					auto ldc  = int64_t(out.shape()[1]);
+
+					ger(m,
+						n,
+						static_cast<Scalar>(m_alpha),
+						a,
+						incA,
+						b,
+						incB,
+						static_cast<Scalar>(m_beta),
+						c,
+						ldc,
+						Backend());
+
+					applyEpilogueToAll(m, n);
+					break;
+				}
+				case MatmulClass::BATCHED_GEMM: {
+					const auto &shapeA	  = m_a.shape();
+					const auto &shapeB	  = m_b.shape();
+					const int64_t offsetA = shapeA.ndim() - 2;
+					const int64_t offsetB = shapeB.ndim() - 2;
+
+					auto batch = int64_t(out.shape()[0]);
+					auto m	   = int64_t(shapeA[offsetA + m_transA]);
+					auto n	   = int64_t(shapeB[offsetB + 1 - m_transB]);
+					auto k	   = int64_t(shapeA[offsetA + 1 - m_transA]);
+
+					auto lda = int64_t(shapeA[offsetA + 1]);
+					auto ldb = int64_t(shapeB[offsetB + 1]);
+					auto ldc = n;
+
+					// A 2-dimensional operand is used for every product in the batch
+					auto strideA =
+					  shapeA.ndim() == 3 ? int64_t(shapeA[1]) * int64_t(shapeA[2]) : int64_t(0);
+					auto strideB =
+					  shapeB.ndim() == 3 ? int64_t(shapeB[1]) * int64_t(shapeB[2]) : int64_t(0);
+					auto strideC = m * n;
+
+					gemmBatched(m_transA,
+								m_transB,
+								m,
+								n,
+								k,
+								static_cast<Scalar>(m_alpha),
+								a,
+								lda,
+								strideA,
+								b,
+								ldb,
+								strideB,
+								static_cast<Scalar>(m_beta),
+								c,
+								ldc,
+								strideC,
+								batch,
+								Backend());
+
+					applyEpilogueToAll(batch * m, n);
 					break;
 				}
 				default: {
@@ -474,13 +716,135 @@ namespace librapid {
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
 		template<typename T, typename Char, size_t N, typename Ctx>
-		void ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::str(
+		void ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta, TransA,
+						   TransB>::str(
 		  const fmt::formatter<T, Char> &format, char bracket, char separator,
 		  const char (&formatString)[N], Ctx &ctx) const {
 			eval().str(format, bracket, separator, formatString, ctx);
 		}
+
+		/// \brief An array multiplication with a fused, element-wise epilogue
+		///
+		/// Created by ArrayMultiply::withEpilogue. Evaluating it (or assigning it to an array)
+		/// computes the product and applies the epilogue to it in a single pass over the result.
+		/// \tparam Multiply The ArrayMultiply type
+		/// \tparam Epilogue Type of the epilogue (see epilogue.hpp)
+		template<typename Multiply, typename Epilogue>
+		class FusedArrayMultiply {
+		public:
+			using MultiplyType = Multiply;
+			using EpilogueType = Epilogue;
+			using Scalar	   = typename Multiply::Scalar;
+			using ShapeType	   = typename Multiply::ShapeType;
+			using Backend	   = typename Multiply::Backend;
+
+			/// Default constructor (deleted)
+			FusedArrayMultiply() = delete;
+
+			/// \brief Attach an epilogue to an array multiplication
+			/// \param multiply The array multiplication
+			/// \param epilogue The epilogue to apply to its result
+			template<typename Fn>
+			FusedArrayMultiply(const Multiply &multiply, Fn &&epilogue);
+
+			/// Copy constructor
+			FusedArrayMultiply(const FusedArrayMultiply &) = default;
+
+			/// Move constructor
+			FusedArrayMultiply(FusedArrayMultiply &&) noexcept = default;
+
+			/// \brief Determine the shape of the result
+			/// \return Shape of the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ShapeType shape() const;
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t size() const;
+
+			/// \brief Determine the number of dimensions of the result
+			/// \return Number of dimensions of the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t ndim() const;
+
+			/// \brief Force evaluation of the fused operation, returning an Array object
+			/// \return Array object containing the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const;
+
+			/// \brief Get the array multiplication
+			/// \return The array multiplication, without the epilogue
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Multiply &multiply() const;
+
+			/// \brief Get the epilogue
+			/// \return The epilogue
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Epilogue &epilogue() const;
+
+			/// \brief Apply the fused operation to an array container
+			/// \tparam StorageType Storage type of the array container
+			/// \param out Array container to store the result in
+			/// \see ArrayMultiply::applyTo
+			template<typename StorageType>
+			void applyTo(array::ArrayContainer<ShapeType, StorageType> &out) const;
+
+			template<typename T, typename Char, size_t N, typename Ctx>
+			void str(const fmt::formatter<T, Char> &format, char bracket, char separator,
+					 const char (&formatString)[N], Ctx &ctx) const;
+
+		private:
+			Multiply m_multiply; // The array multiplication
+			Epilogue m_epilogue; // Applied to each element of the result
+		};
+
+		template<typename Multiply, typename Epilogue>
+		template<typename Fn>
+		FusedArrayMultiply<Multiply, Epilogue>::FusedArrayMultiply(const Multiply &multiply,
+																	Fn &&epilogue) :
+				m_multiply(multiply),
+				m_epilogue(std::forward<Fn>(epilogue)) {}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::shape() const -> ShapeType {
+			return m_multiply.shape();
+		}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::size() const -> size_t {
+			return m_multiply.size();
+		}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::ndim() const -> int64_t {
+			return m_multiply.ndim();
+		}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::eval() const {
+			return m_multiply.eval(m_epilogue);
+		}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::multiply() const -> const Multiply & {
+			return m_multiply;
+		}
+
+		template<typename Multiply, typename Epilogue>
+		auto FusedArrayMultiply<Multiply, Epilogue>::epilogue() const -> const Epilogue & {
+			return m_epilogue;
+		}
+
+		template<typename Multiply, typename Epilogue>
+		template<typename StorageType>
+		void FusedArrayMultiply<Multiply, Epilogue>::applyTo(
+		  array::ArrayContainer<ShapeType, StorageType> &out) const {
+			m_multiply.applyTo(out, m_epilogue);
+		}
+
+		template<typename Multiply, typename Epilogue>
+		template<typename T, typename Char, size_t N, typename Ctx>
+		void FusedArrayMultiply<Multiply, Epilogue>::str(const fmt::formatter<T, Char> &format,
+														 char bracket, char separator,
+														 const char (&formatString)[N],
+														 Ctx &ctx) const {
+			eval().str(format, bracket, separator, formatString, ctx);
+		}
 	} // namespace linalg
 
 	//	/// \brief Computes the dot product of two arrays.
@@ -514,11 +878,12 @@ namespace librapid {
 		template<typename ShapeType, typename DestinationStorageType, typename ShapeTypeA,
 				 typename StorageTypeA, typename ShapeTypeB, typename StorageTypeB,
 				 typename Alpha = typename StorageTypeA::Scalar,
-				 typename Beta	= typename StorageTypeB::Scalar>
+				 typename Beta	= typename StorageTypeB::Scalar, bool TransA = false,
+				 bool TransB = false>
 		LIBRAPID_ALWAYS_INLINE void
 		assign(array::ArrayContainer<ShapeType, DestinationStorageType> &destination,
 			   const linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB,
-										   Alpha, Beta> &op) {
+										   Alpha, Beta, TransA, TransB> &op) {
 			op.applyTo(destination);
 		}
 
@@ -532,14 +897,39 @@ namespace librapid {
 
 		/// Returns a tuple of the form (transpose, raw array) where transpose is true if the array
 		/// is transposed and false otherwise, and raw array is the raw array data.
+		///
+		/// Only a transpose of a matrix, or a swap of the last two axes of a batch of matrices,
+		/// can be passed to GEMM as a transpose flag. Any other permutation is evaluated, and
+		/// the result is returned untransposed.
 		/// \tparam T
 		/// \param val
 		/// \return
 		template<typename T>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto transposeExtractor(T &&val) {
 			if constexpr (IsTransposeType<T>::value) {
-				using Type = decltype(val.array());
-				return std::make_tuple(true, val.alpha(), std::forward<Type>(val.array()));
+				using Type		= decltype(val.array());
+				using ArrayType = std::decay_t<Type>;
+				using Scalar	= typename std::decay_t<T>::Scalar;
+				using Result	= std::tuple<bool, Scalar, ArrayType>;
+
+				if constexpr (typetraits::IsArrayContainer<ArrayType>::value) {
+					// Fixed-size matrices are always two-dimensional
+					using Fixed = typetraits::FixedMatrixInfo<typename ArrayType::StorageType>;
+					if constexpr (!Fixed::value) {
+						const auto &axes   = val.axes();
+						const int64_t ndim = val.ndim();
+						const bool swapsMatrices =
+						  ndim == 2 || (ndim == 3 && axes[0] == 0 && axes[1] == 2 && axes[2] == 1);
+
+						if (!swapsMatrices) {
+							ArrayType evaluated(val.shape());
+							val.applyTo(evaluated);
+							return Result(false, Scalar(1), std::move(evaluated));
+						}
+					}
+				}
+
+				return Result(true, val.alpha(), std::forward<Type>(val.array()));
 			} else {
 				using Scalar = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
 				return std::make_tuple(false, Scalar(1), std::forward<T>(val));
@@ -611,6 +1001,22 @@ namespace librapid {
 				return std::make_tuple(false, Scalar(1), std::forward<T>(val));
 			}
 		}
+
+		/// Evaluates to true if an argument to dot() is transposed an odd number of times, in
+		/// which case dotHelper() returns it with the transpose flag set. Scaling by a constant
+		/// does not change this.
+		/// \tparam T
+		template<typename T>
+		struct TransposeParity : std::false_type {};
+
+		template<typename T>
+		struct TransposeParity<array::Transpose<T>>
+				: std::bool_constant<!TransposeParity<std::decay_t<T>>::value> {};
+
+		template<typename Descriptor, typename Left, typename Right>
+		struct TransposeParity<detail::Function<Descriptor, detail::Multiply, Left, Right>>
+				: std::bool_constant<TransposeParity<std::decay_t<Left>>::value !=
+									 TransposeParity<std::decay_t<Right>>::value> {};
 	} // namespace detail
 
 	/// \brief Computes the dot product of two arrays.
@@ -628,8 +1034,16 @@ namespace librapid {
 	///
 	/// If both inputs are 2-dimensional matrices, this function computes the matrix-matrix product
 	/// \f$ c_{ij} = \sum_{k=1}^{n} a_{ik} b_{kj} \f$ for \f$ i = 1, \ldots, m \f$ and \f$ j = 1,
-	/// \ldots, p \f$. \tparam StorageTypeA The storage type of the left input array. \tparam
-	/// StorageTypeB The storage type of the right input array. \param a The left input array.
+	/// \ldots, p \f$. If the left input is a column of shape [m, 1] and the right input is a
+	/// row of shape [1, n], this is the outer product \f$ c_{ij} = a_i b_j \f$, which is written
+	/// directly without a reduction.
+	///
+	/// If either input is 3-dimensional, the product is computed for each matrix in the batch,
+	/// so a [batch, m, k] array and a [batch, k, n] array give a [batch, m, n] result. A
+	/// 2-dimensional input is used for every product in the batch.
+	/// \tparam StorageTypeA The storage type of the left input array.
+	/// \tparam StorageTypeB The storage type of the right input array.
+	/// \param a The left input array.
 	/// \param b The right input array.
 	/// \return The dot product of the two input arrays.
 	template<typename First, typename Second>
@@ -637,35 +1051,41 @@ namespace librapid {
 	auto dot(First &&a, Second &&b) {
 		using ScalarA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
 		using ScalarB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
-		using BackendA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Backend;
-		using BackendB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
-		using ArrayA	   = Array<ScalarA, BackendA>;
-		using ArrayB	   = Array<ScalarB, BackendB>;
 		using ShapeTypeA   = typename typetraits::TypeInfo<std::decay_t<First>>::ShapeType;
 		using ShapeTypeB   = typename typetraits::TypeInfo<std::decay_t<Second>>::ShapeType;
 		using StorageTypeA = typename typetraits::TypeInfo<std::decay_t<First>>::StorageType;
 		using StorageTypeB = typename typetraits::TypeInfo<std::decay_t<Second>>::StorageType;
+		using ArrayA	   = array::ArrayContainer<ShapeTypeA, StorageTypeA>;
+		using ArrayB	   = array::ArrayContainer<ShapeTypeB, StorageTypeB>;
+
+		// Fixed-size matrices are always passed to GEMM with their transpose flags, so the
+		// flags are known at compile time, along with the shape of the result
+		constexpr bool fixedTransA = typetraits::FixedMatrixInfo<StorageTypeA>::value &&
+									 detail::TransposeParity<std::decay_t<First>>::value;
+		constexpr bool fixedTransB = typetraits::FixedMatrixInfo<StorageTypeB>::value &&
+									 detail::TransposeParity<std::decay_t<Second>>::value;
+
+		using Multiply = linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB,
+											   ScalarA, ScalarB, fixedTransA, fixedTransB>;
 
 		auto [transA, alpha, arrA] = detail::dotHelper(std::forward<First>(a));
 		auto [transB, beta, arrB]  = detail::dotHelper(std::forward<Second>(b));
-		return linalg::
-		  ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, ScalarA, ScalarB>(
-			transA,
-			transB,
-			std::forward<ArrayA>(arrA),
-			alpha * beta,
-			std::forward<ArrayB>(arrB),
-			ScalarA(0));
+		return Multiply(transA,
+						transB,
+						std::forward<ArrayA>(arrA),
+						alpha * beta,
+						std::forward<ArrayB>(arrB),
+						ScalarA(0));
 	}
 
 	namespace typetraits {
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
-				 typename StorageTypeB, typename Alpha, typename Beta>
-		struct TypeInfo<
-		  linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>> {
+				 typename StorageTypeB, typename Alpha, typename Beta, bool TransA, bool TransB>
+		struct TypeInfo<linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB,
+											  Alpha, Beta, TransA, TransB>> {
 			detail::LibRapidType type = detail::LibRapidType::ArrayFunction;
 			using Type	 = linalg::ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB,
-												 Alpha, Beta>;
+												 Alpha, Beta, TransA, TransB>;
 			using Scalar = typename Type::Scalar;
 			using Backend							 = typename Type::Backend;
 			static constexpr bool allowVectorisation = false;
@@ -673,21 +1093,44 @@ namespace librapid {
 
 		LIBRAPID_DEFINE_AS_TYPE(typename ShapeTypeA COMMA typename StorageTypeA COMMA
 								typename ShapeTypeB COMMA typename StorageTypeB COMMA
-								typename Alpha COMMA typename Beta,
+								typename Alpha COMMA typename Beta COMMA bool TransA COMMA
+								bool TransB,
 								linalg::ArrayMultiply<ShapeTypeA COMMA StorageTypeA COMMA ShapeTypeB
-														COMMA StorageTypeB COMMA Alpha COMMA Beta>);
+														COMMA StorageTypeB COMMA Alpha COMMA Beta
+														COMMA TransA COMMA TransB>);
+
+		template<typename Multiply, typename Epilogue>
+		struct TypeInfo<linalg::FusedArrayMultiply<Multiply, Epilogue>> {
+			static constexpr detail::LibRapidType type = detail::LibRapidType::ArrayFunction;
+			using Type	  = linalg::FusedArrayMultiply<Multiply, Epilogue>;
+			using Scalar  = typename Type::Scalar;
+			using Backend = typename Type::Backend;
+			static constexpr bool allowVectorisation = false;
+		};
+
+		LIBRAPID_DEFINE_AS_TYPE(typename Multiply COMMA typename Epilogue,
+								linalg::FusedArrayMultiply<Multiply COMMA Epilogue>);
 	} // namespace typetraits
 } // namespace librapid
 
 ARRAY_TYPE_FMT_IML(typename ShapeTypeA COMMA typename StorageTypeA COMMA typename ShapeTypeB COMMA
-				   typename StorageTypeB COMMA typename Alpha COMMA typename Beta,
+				   typename StorageTypeB COMMA typename Alpha COMMA typename Beta COMMA
+				   bool TransA COMMA bool TransB,
 				   librapid::linalg::ArrayMultiply<ShapeTypeA COMMA StorageTypeA COMMA ShapeTypeB
-													 COMMA StorageTypeB COMMA Alpha COMMA Beta>)
+													 COMMA StorageTypeB COMMA Alpha COMMA Beta
+													 COMMA TransA COMMA TransB>)
 
 LIBRAPID_SIMPLE_IO_NORANGE(
   typename ShapeTypeA COMMA typename StorageTypeA COMMA typename ShapeTypeB COMMA
-  typename StorageTypeB COMMA typename Alpha COMMA typename Beta,
-  librapid::linalg::ArrayMultiply<
-	ShapeTypeA COMMA StorageTypeA COMMA ShapeTypeB COMMA StorageTypeB COMMA Alpha COMMA Beta>)
+  typename StorageTypeB COMMA typename Alpha COMMA typename Beta COMMA bool TransA COMMA
+  bool TransB,
+  librapid::linalg::ArrayMultiply<ShapeTypeA COMMA StorageTypeA COMMA ShapeTypeB COMMA StorageTypeB
+									COMMA Alpha COMMA Beta COMMA TransA COMMA TransB>)
+
+ARRAY_TYPE_FMT_IML(typename Multiply COMMA typename Epilogue,
+				   librapid::linalg::FusedArrayMultiply<Multiply COMMA Epilogue>)
+
+LIBRAPID_SIMPLE_IO_NORANGE(typename Multiply COMMA typename Epilogue,
+						   librapid::linalg::FusedArrayMultiply<Multiply COMMA Epilogue>)
 
 #endif // LIBRAPID_ARRAY_LINALG_ARRAY_MULTIPLY_HPP
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef LIBRAPID_ARRAY_LINALG_EPILOGUE_HPP
+#define LIBRAPID_ARRAY_LINALG_EPILOGUE_HPP
+
+/*
+ * An epilogue is an element-wise operation applied to the result of an array multiplication
+ * while it is being computed, rather than in separate passes over the output afterwards. For
+ * example, the forward pass of a dense layer, C = activation(A B + bias), would otherwise read
+ * and write C three times.
+ *
+ * An epilogue is a callable object of the form
+ *
+ *     Scalar epilogue(Scalar value, int64_t row, int64_t col)
+ *
+ * which returns the final value of the element at (row, col) of the result, given the value of
+ * the product there.
+ *
+ * An epilogue object may also provide a member function of the form
+ *
+ *     Packet packet(Packet value, int64_t row, int64_t col) const
+ *
+ * where Packet is typetraits::TypeInfo<Scalar>::Packet, which returns the final values of a
+ * packet of consecutive elements in a row, starting at (row, col). It is used wherever a whole
+ * packet of the result is available, and the scalar form is used for the remaining elements.
+ */
+
+namespace librapid {
+	namespace linalg {
+		/// The epilogue used by default, which leaves the result of an array multiplication
+		/// unchanged
+		struct NoEpilogue {};
+	} // namespace linalg
+
+	namespace typetraits {
+		/// Evaluates to true if \p T is an epilogue which does nothing
+		template<typename T>
+		struct IsNoEpilogue : std::is_same<std::decay_t<T>, linalg::NoEpilogue> {};
+
+		/// Evaluates to true if \p Epilogue provides a packet form for elements of type
+		/// \p Scalar (see epilogue.hpp). This is always false for types which are not
+		/// vectorised
+		template<typename Epilogue, typename Scalar,
+				 bool Vectorise = TypeInfo<Scalar>::allowVectorisation &&
+								  (TypeInfo<Scalar>::packetWidth > 1)>
+		struct IsPacketEpilogue : std::false_type {};
+
+		template<typename Epilogue, typename Scalar>
+		struct IsPacketEpilogue<Epilogue, Scalar, true>
+				: std::bool_constant<requires(const Epilogue &epilogue,
+											  const typename TypeInfo<Scalar>::Packet &value,
+											  int64_t index) {
+					  epilogue.packet(value, index, index);
+				  }> {};
+	} // namespace typetraits
+
+	namespace detail::cpu {
+		/// The smallest number of rows in a block of a matrix product computed by BLAS. Each
+		/// block is a separate call to gemm, which reads the whole of \f$ \mathbf{B} \f$ again,
+		/// so very short blocks would turn the product into a series of memory-bound calls.
+		constexpr int64_t epilogueMinRows = 128;
+
+		/// Return the number of rows of a matrix product to compute before applying the epilogue,
+		/// so that each block of the result still fits in the L2 cache when the epilogue is
+		/// applied to it. Blocks contain at least epilogueMinRows rows (or all of them), even if
+		/// they do not fit
+		/// \param rows Number of rows in the result
+		/// \param cols Number of columns in the result
+		/// \param elementSize Size of each element of the result in bytes
+		/// \return Number of rows per block
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t
+		epilogueBlockRows(int64_t rows, int64_t cols, int64_t elementSize) {
+			const int64_t rowBytes = std::max<int64_t>(cols * elementSize, 1);
+			const int64_t fit	   = static_cast<int64_t>(global::l2CacheSize) / rowBytes;
+			return std::max<int64_t>(std::min(rows, std::max(fit, epilogueMinRows)), 1);
+		}
+
+		/// Apply an epilogue to a tile of a row-major matrix on the calling thread, using the
+		/// packet form of the epilogue where it has one
+		/// \param c Pointer to the first element of the tile
+		/// \param ldc Leading dimension of the matrix
+		/// \param row Row of the matrix containing the first element of the tile
+		/// \param col Column of the matrix containing the first element of the tile
+		/// \param rows Number of rows in the tile
+		/// \param cols Number of columns in the tile
+		/// \param epilogue The epilogue to apply
+		template<typename Scalar, typename Epilogue>
+		LIBRAPID_ALWAYS_INLINE void applyEpilogueTile(Scalar *c, int64_t ldc, int64_t row,
+													  int64_t col, int64_t rows, int64_t cols,
+													  const Epilogue &epilogue) {
+			for (int64_t i = 0; i < rows; ++i) {
+				Scalar *out = c + i * ldc;
+				int64_t j	= 0;
+
+				if constexpr (typetraits::IsPacketEpilogue<Epilogue, Scalar>::value) {
+					using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+					constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					for (; j + packetWidth <= cols; j += packetWidth) {
+						const Packet result =
+						  epilogue.packet(xsimd::load_unaligned(out + j), row + i, col + j);
+						result.store_unaligned(out + j);
+					}
+				}
+
+				for (; j < cols; ++j) {
+					out[j] = static_cast<Scalar>(epilogue(out[j], row + i, col + j));
+				}
+			}
+		}
+
+		/// Apply an epilogue to rows [first, last) of a row-major matrix. Large blocks are split
+		/// into runs of rows, which are processed in parallel unless the caller is already
+		/// running on the thread pool.
+		/// \param c Pointer to the matrix
+		/// \param ldc Leading dimension of the matrix
+		/// \param first First row to process
+		/// \param last One past the last row to process
+		/// \param cols Number of columns in the matrix
+		/// \param epilogue The epilogue to apply
+		template<typename Scalar, typename Epilogue>
+		void applyEpilogue(Scalar *c, int64_t ldc, int64_t first, int64_t last, int64_t cols,
+						   const Epilogue &epilogue) {
+			auto applyRows = [&](int64_t begin, int64_t end) {
+				applyEpilogueTile(
+				  c + begin * ldc, ldc, begin, int64_t(0), end - begin, cols, epilogue);
+			};
+
+			if (global::numThreads > 1 && last - first > 1 &&
+				(last - first) * cols > static_cast<int64_t>(global::multithreadThreshold) &&
+				!ThreadPool::inParallelRegion()) {
+				parallelFor(first, last, applyRows);
+				return;
+			}
+
+			applyRows(first, last);
+		}
+	} // namespace detail::cpu
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_EPILOGUE_HPP
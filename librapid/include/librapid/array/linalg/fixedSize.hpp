@@ -0,0 +1,282 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FIXED_SIZE_HPP
+#define LIBRAPID_ARRAY_LINALG_FIXED_SIZE_HPP
+
+/*
+ * Kernels for small matrices whose dimensions are known at compile time (i.e. matrices stored
+ * in a two-dimensional FixedStorage object, such as MatrixF<float, 4, 4>). Every loop is
+ * unrolled, so the products, transposes and inverses run entirely in registers, without
+ * allocating memory or dispatching to BLAS.
+ */
+
+namespace librapid {
+	namespace typetraits {
+		/// Provides the dimensions of a storage type if it is a two-dimensional FixedStorage
+		/// object (i.e. a fixed-size matrix)
+		/// \tparam T The storage type
+		template<typename T>
+		struct FixedMatrixInfo {
+			static constexpr bool value = false;
+			static constexpr size_t rows = 0;
+			static constexpr size_t cols = 0;
+		};
+
+		template<typename Scalar, size_t Rows, size_t Cols>
+		struct FixedMatrixInfo<FixedStorage<Scalar, Rows, Cols>> {
+			static constexpr bool value	 = true;
+			static constexpr size_t rows = Rows;
+			static constexpr size_t cols = Cols;
+		};
+
+		/// Describes the product \f$ \mathrm{op}(\mathbf{A}) \mathrm{op}(\mathbf{B}) \f$ of two
+		/// fixed-size operands with the storage types \p StorageA and \p StorageB, where
+		/// \p TransA and \p TransB are the transpose flags. A matrix may be multiplied by a
+		/// matrix or by a vector, and two vectors give their dot product.
+		///
+		/// The product is described as a rows x inner matrix multiplied by an inner x cols
+		/// matrix, where a vector on the left is a single row and a vector on the right is a
+		/// single column, so the dimensions of the result are known at compile time. ndim is 1
+		/// if the result is a vector and 2 if it is a matrix, and Storage is the storage type of
+		/// the result.
+		/// \tparam StorageA Storage type of \f$ \mathbf{A} \f$
+		/// \tparam StorageB Storage type of \f$ \mathbf{B} \f$
+		/// \tparam TransA Whether \f$ \mathbf{A} \f$ is transposed
+		/// \tparam TransB Whether \f$ \mathbf{B} \f$ is transposed
+		template<typename StorageA, typename StorageB, bool TransA, bool TransB>
+		struct FixedProductInfo {
+			static constexpr bool value	 = false;
+			static constexpr bool transA = false;
+			static constexpr bool transB = false;
+		};
+
+		template<typename ScalarA, size_t RowsA, size_t ColsA, typename ScalarB, size_t RowsB,
+				 size_t ColsB, bool TransA, bool TransB>
+		struct FixedProductInfo<FixedStorage<ScalarA, RowsA, ColsA>,
+								FixedStorage<ScalarB, RowsB, ColsB>, TransA, TransB> {
+			static constexpr bool value	  = true;
+			static constexpr int64_t ndim = 2;
+			static constexpr size_t rows  = TransA ? ColsA : RowsA;
+			static constexpr size_t cols  = TransB ? RowsB : ColsB;
+			static constexpr size_t inner = TransA ? RowsA : ColsA;
+			static constexpr bool transA  = TransA;
+			static constexpr bool transB  = TransB;
+
+			static_assert(inner == (TransB ? ColsB : RowsB),
+						  "Inner dimensions of matrices must match");
+
+			template<typename Scalar>
+			using Storage = FixedStorage<Scalar, rows, cols>;
+		};
+
+		template<typename ScalarA, size_t RowsA, size_t ColsA, typename ScalarB, size_t Elements,
+				 bool TransA, bool TransB>
+		struct FixedProductInfo<FixedStorage<ScalarA, RowsA, ColsA>,
+								FixedStorage<ScalarB, Elements>, TransA, TransB> {
+			static constexpr bool value	  = true;
+			static constexpr int64_t ndim = 1;
+			static constexpr size_t rows  = TransA ? ColsA : RowsA;
+			static constexpr size_t cols  = 1;
+			static constexpr size_t inner = TransA ? RowsA : ColsA;
+			static constexpr bool transA  = TransA;
+			static constexpr bool transB  = false;
+
+			static_assert(inner == Elements, "Columns of OP(A) must match elements of B");
+
+			template<typename Scalar>
+			using Storage = FixedStorage<Scalar, rows>;
+		};
+
+		template<typename ScalarA, size_t ElementsA, typename ScalarB, size_t ElementsB,
+				 bool TransA, bool TransB>
+		struct FixedProductInfo<FixedStorage<ScalarA, ElementsA>, FixedStorage<ScalarB, ElementsB>,
+								TransA, TransB> {
+			static constexpr bool value	  = true;
+			static constexpr int64_t ndim = 1;
+			static constexpr size_t rows  = 1;
+			static constexpr size_t cols  = 1;
+			static constexpr size_t inner = ElementsA;
+			static constexpr bool transA  = false;
+			static constexpr bool transB  = false;
+
+			static_assert(ElementsA == ElementsB, "Vector dimensions must match");
+
+			template<typename Scalar>
+			using Storage = FixedStorage<Scalar, 1>;
+		};
+	} // namespace typetraits
+
+	namespace detail::cpu {
+		/// The largest dimension of a fixed-size matrix which is handled by the unrolled
+		/// kernels. Larger matrices would generate too much code, so they use the general
+		/// implementations instead.
+		constexpr size_t maxUnrolledDimension = 8;
+
+		/// Call \p fn(0), \p fn(1), ..., \p fn(N - 1), with the loop unrolled at compile time
+		/// \tparam N Number of iterations
+		/// \tparam Fn Loop body type
+		/// \param fn Loop body
+		template<size_t N, typename Fn>
+		LIBRAPID_ALWAYS_INLINE void unroll(Fn &&fn) {
+			[&]<size_t... I>(std::index_sequence<I...>) {
+				(fn(I), ...);
+			}(std::make_index_sequence<N>());
+		}
+
+		/// Compute \f$ \mathbf{C} = \alpha \mathrm{op}(\mathbf{A}) \mathrm{op}(\mathbf{B}) +
+		/// \beta \mathbf{C} \f$ for row-major matrices, where \f$ \mathrm{op}(\mathbf{A}) \f$ is
+		/// \f$ M \times K \f$ and \f$ \mathrm{op}(\mathbf{B}) \f$ is \f$ K \times N \f$. Each row
+		/// of \f$ \mathbf{C} \f$ is accumulated in registers before it is written, and if
+		/// \f$ \beta \f$ is zero, \f$ \mathbf{C} \f$ is not read.
+		template<size_t M, size_t N, size_t K, bool TransA, bool TransB, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void fixedGemm(const Scalar &alpha, const Scalar *a,
+											  const Scalar *b, const Scalar &beta, Scalar *c) {
+			static_assert(K > 0, "Inner dimension must not be empty");
+
+			auto opA = [a](size_t i, size_t p) -> const Scalar & {
+				return TransA ? a[p * M + i] : a[i * K + p];
+			};
+
+			auto opB = [b](size_t p, size_t j) -> const Scalar & {
+				return TransB ? b[j * K + p] : b[p * N + j];
+			};
+
+			const bool betaZero = beta == Scalar(0);
+
+			unroll<M>([&](size_t i) {
+				Scalar row[N];
+				unroll<N>([&](size_t j) { row[j] = opA(i, 0) * opB(0, j); });
+				unroll<K - 1>([&](size_t p) {
+					unroll<N>([&](size_t j) { row[j] += opA(i, p + 1) * opB(p + 1, j); });
+				});
+
+				unroll<N>([&](size_t j) {
+					Scalar &out = c[i * N + j];
+					out			= betaZero ? alpha * row[j] : alpha * row[j] + beta * out;
+				});
+			});
+		}
+
+		/// Write the scaled transpose of a fixed-size, row-major Rows x Cols matrix into
+		/// \p out (a Cols x Rows matrix)
+		template<size_t Rows, size_t Cols, typename Scalar, typename Alpha>
+		LIBRAPID_ALWAYS_INLINE void fixedTranspose(Scalar *out, const Scalar *in,
+												   const Alpha &alpha) {
+			unroll<Rows>([&](size_t i) {
+				unroll<Cols>([&](size_t j) { out[j * Rows + i] = in[i * Cols + j] * alpha; });
+			});
+		}
+
+		/// Write the inverse of a fixed-size, row-major N x N matrix into \p out. Matrices of
+		/// up to 3 x 3 elements use the adjugate formula. Larger matrices use Gauss-Jordan
+		/// elimination with partial pivoting.
+		template<size_t N, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void fixedInverse(Scalar *out, const Scalar *in) {
+			if constexpr (N == 1) {
+				LIBRAPID_ASSERT(in[0] != Scalar(0), "Cannot invert a singular matrix");
+				out[0] = Scalar(1) / in[0];
+			} else if constexpr (N == 2) {
+				const Scalar det = in[0] * in[3] - in[1] * in[2];
+				LIBRAPID_ASSERT(det != Scalar(0), "Cannot invert a singular matrix");
+				const Scalar invDet = Scalar(1) / det;
+
+				out[0] = in[3] * invDet;
+				out[1] = -in[1] * invDet;
+				out[2] = -in[2] * invDet;
+				out[3] = in[0] * invDet;
+			} else if constexpr (N == 3) {
+				// Cofactors of the first row
+				const Scalar c00 = in[4] * in[8] - in[5] * in[7];
+				const Scalar c01 = in[5] * in[6] - in[3] * in[8];
+				const Scalar c02 = in[3] * in[7] - in[4] * in[6];
+
+				const Scalar det = in[0] * c00 + in[1] * c01 + in[2] * c02;
+				LIBRAPID_ASSERT(det != Scalar(0), "Cannot invert a singular matrix");
+				const Scalar invDet = Scalar(1) / det;
+
+				out[0] = c00 * invDet;
+				out[1] = (in[2] * in[7] - in[1] * in[8]) * invDet;
+				out[2] = (in[1] * in[5] - in[2] * in[4]) * invDet;
+				out[3] = c01 * invDet;
+				out[4] = (in[0] * in[8] - in[2] * in[6]) * invDet;
+				out[5] = (in[2] * in[3] - in[0] * in[5]) * invDet;
+				out[6] = c02 * invDet;
+				out[7] = (in[1] * in[6] - in[0] * in[7]) * invDet;
+				out[8] = (in[0] * in[4] - in[1] * in[3]) * invDet;
+			} else {
+				// Reduce [in | I] to [I | in^-1]. The pivot row is chosen at runtime, but every
+				// row operation is unrolled
+				Scalar lhs[N][N];
+				Scalar rhs[N][N];
+				unroll<N>([&](size_t i) {
+					unroll<N>([&](size_t j) {
+						lhs[i][j] = in[i * N + j];
+						rhs[i][j] = Scalar(i == j);
+					});
+				});
+
+				for (size_t col = 0; col < N; ++col) {
+					size_t pivot = col;
+					for (size_t row = col + 1; row < N; ++row) {
+						if (std::abs(lhs[row][col]) > std::abs(lhs[pivot][col])) pivot = row;
+					}
+
+					LIBRAPID_ASSERT(lhs[pivot][col] != Scalar(0),
+									"Cannot invert a singular matrix");
+
+					if (pivot != col) {
+						unroll<N>([&](size_t j) {
+							std::swap(lhs[pivot][j], lhs[col][j]);
+							std::swap(rhs[pivot][j], rhs[col][j]);
+						});
+					}
+
+					const Scalar invPivot = Scalar(1) / lhs[col][col];
+					unroll<N>([&](size_t j) {
+						lhs[col][j] *= invPivot;
+						rhs[col][j] *= invPivot;
+					});
+
+					unroll<N>([&](size_t row) {
+						if (row == col) return;
+						const Scalar factor = lhs[row][col];
+						unroll<N>([&](size_t j) {
+							lhs[row][j] -= factor * lhs[col][j];
+							rhs[row][j] -= factor * rhs[col][j];
+						});
+					});
+				}
+
+				unroll<N>([&](size_t i) {
+					unroll<N>([&](size_t j) { out[i * N + j] = rhs[i][j]; });
+				});
+			}
+		}
+	} // namespace detail::cpu
+
+	/// \brief Compute the inverse of a fixed-size square matrix
+	///
+	/// The result is computed with unrolled kernels which do not allocate any memory, and has
+	/// the same type as the input. Matrices larger than 8 x 8 are not supported.
+	///
+	/// \code{.cpp}
+	/// lrc::MatrixF<float, 4, 4> transform = ...;
+	/// auto inverse = lrc::inverse(transform);
+	/// \endcode
+	/// \tparam ShapeType The shape type of the matrix
+	/// \tparam Scalar The scalar type of the matrix. This must be a floating point type
+	/// \tparam N The number of rows (and columns) in the matrix
+	/// \param matrix The matrix to invert. It must not be singular
+	/// \return The inverse of the matrix
+	template<typename ShapeType, typename Scalar, size_t N>
+	LIBRAPID_NODISCARD auto
+	inverse(const array::ArrayContainer<ShapeType, FixedStorage<Scalar, N, N>> &matrix) {
+		static_assert(!std::is_integral_v<Scalar>, "Cannot invert an integer matrix");
+		static_assert(N <= detail::cpu::maxUnrolledDimension,
+					  "Only matrices of up to 8 x 8 elements can be inverted");
+
+		array::ArrayContainer<ShapeType, FixedStorage<Scalar, N, N>> result(matrix);
+		detail::cpu::fixedInverse<N>(result.storage().data(), matrix.storage().data());
+		return result;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FIXED_SIZE_HPP
@@ -0,0 +1,192 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
+
+namespace librapid {
+    namespace detail::cpu {
+        /// Compute the dot product of \p n elements of two vectors. The products are added into
+        /// four independent accumulators, so consecutive additions do not have to wait for each
+        /// other. Contiguous vectors of a type with SIMD support are processed with packet
+        /// loads and fused multiply-adds.
+        /// \tparam Result The type to accumulate in
+        /// \param n Number of elements
+        /// \param x Pointer to the first vector
+        /// \param incX Increment of \p x
+        /// \param y Pointer to the second vector
+        /// \param incY Increment of \p y
+        /// \return The sum of the products
+        template<typename Result, typename X, typename Y>
+        LIBRAPID_NODISCARD Result dotRange(int64_t n, const X *__restrict x, int64_t incX,
+                                           const Y *__restrict y, int64_t incY) {
+            // Operands of const arrays are const, but are still loaded as packets
+            using Info               = typetraits::TypeInfo<Result>;
+            constexpr bool vectorise = std::is_same_v<std::remove_const_t<X>, Result> &&
+                                       std::is_same_v<std::remove_const_t<Y>, Result> &&
+                                       Info::allowVectorisation && Info::packetWidth > 1;
+
+            Result acc[4] = {Result(0), Result(0), Result(0), Result(0)};
+            int64_t i     = 0;
+
+            if constexpr (vectorise) {
+                if (incX == 1 && incY == 1) {
+                    using Packet        = typename Info::Packet;
+                    constexpr int64_t W = Info::packetWidth;
+                    Packet acc0(Result(0));
+                    Packet acc1 = acc0, acc2 = acc0, acc3 = acc0;
+
+                    for (; i + 4 * W <= n; i += 4 * W) {
+                        acc0 = xsimd::fma(xsimd::load_unaligned(x + i),
+                                          xsimd::load_unaligned(y + i),
+                                          acc0);
+                        acc1 = xsimd::fma(xsimd::load_unaligned(x + i + W),
+                                          xsimd::load_unaligned(y + i + W),
+                                          acc1);
+                        acc2 = xsimd::fma(xsimd::load_unaligned(x + i + 2 * W),
+                                          xsimd::load_unaligned(y + i + 2 * W),
+                                          acc2);
+                        acc3 = xsimd::fma(xsimd::load_unaligned(x + i + 3 * W),
+                                          xsimd::load_unaligned(y + i + 3 * W),
+                                          acc3);
+                    }
+
+                    for (; i + W <= n; i += W) {
+                        acc0 = xsimd::fma(
+                          xsimd::load_unaligned(x + i), xsimd::load_unaligned(y + i), acc0);
+                    }
+
+                    acc[0] = horizontalReduce<reduction::Sum>((acc0 + acc1) + (acc2 + acc3));
+                }
+            }
+
+            for (; i + 4 <= n; i += 4) {
+                for (int64_t j = 0; j < 4; ++j) {
+                    acc[j] += Result(x[(i + j) * incX]) * Result(y[(i + j) * incY]);
+                }
+            }
+
+            for (; i < n; ++i) acc[0] += Result(x[i * incX]) * Result(y[i * incY]);
+
+            return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+        }
+    } // namespace detail::cpu
+
+    namespace linalg {
+        /// \brief Vector dot product
+        ///
+        /// Computes \f$ r = \alpha \mathbf{x} \cdot \mathbf{y} + \beta r \f$ for vectors
+        /// \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$ and a scalar \f$ r \f$. If \f$ \beta \f$ is
+        /// zero, \f$ r \f$ is not read.
+        ///
+        /// Long vectors are split into one chunk per thread. The partial sums are combined
+        /// pairwise, in the same way as the sum() reduction.
+        /// \tparam Int Integer type
+        /// \tparam Alpha Alpha scaling factor
+        /// \tparam X First vector type
+        /// \tparam Y Second vector type
+        /// \tparam Beta Beta scaling factor
+        /// \tparam R Result type
+        /// \param n Number of elements in \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$
+        /// \param alpha Scaling factor for \f$ \mathbf{x} \cdot \mathbf{y} \f$
+        /// \param x Pointer to vector \f$ \mathbf{x} \f$
+        /// \param incX Increment of \f$ \mathbf{x} \f$
+        /// \param y Pointer to vector \f$ \mathbf{y} \f$
+        /// \param incY Increment of \f$ \mathbf{y} \f$
+        /// \param beta Scaling factor for \f$ r \f$
+        /// \param result Pointer to the result, \f$ r \f$
+        /// \param backend Backend to use for computation
+        template<typename Int, typename Alpha, typename X, typename Y, typename Beta, typename R>
+        void dot(Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY, Beta beta, R *result,
+                 backend::CPU backend = backend::CPU()) {
+            using Result   = std::remove_cv_t<decltype(std::declval<X>() * std::declval<Y>())>;
+            const auto len = static_cast<int64_t>(n);
+            const auto inX = static_cast<int64_t>(incX);
+            const auto inY = static_cast<int64_t>(incY);
+
+            // Calls from inside a parallel region would run serially anyway
+            const bool multiThread = global::numThreads > 1 &&
+                                     len > static_cast<int64_t>(global::multithreadThreshold) &&
+                                     !detail::ThreadPool::inParallelRegion();
+
+            Result sum;
+            if (multiThread) {
+                constexpr int64_t packetWidth =
+                  std::max<int64_t>(typetraits::TypeInfo<Result>::packetWidth, 1);
+                const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+
+                // Round chunks up to a whole number of packets, so only the last chunk has a
+                // scalar tail
+                const int64_t chunk =
+                  ((len + numThreads - 1) / numThreads + packetWidth - 1) / packetWidth *
+                  packetWidth;
+
+                std::vector<Result> partials(numThreads, Result(0));
+                parallelFor(0, numThreads, [&](int64_t thread) {
+                    const int64_t first = std::min(len, thread * chunk);
+                    const int64_t last  = std::min(len, first + chunk);
+                    partials[thread]    = detail::cpu::dotRange<Result>(
+                      last - first, x + first * inX, inX, y + first * inY, inY);
+                });
+
+                sum = detail::treeCombine<detail::reduction::Sum>(partials);
+            } else {
+                sum = detail::cpu::dotRange<Result>(len, x, inX, y, inY);
+            }
+
+            if (beta == Beta(0)) {
+                *result = static_cast<R>(alpha * sum);
+            } else {
+                *result = static_cast<R>(alpha * sum + beta * *result);
+            }
+        }
+
+#if defined(LIBRAPID_HAS_OPENCL)
+
+        template<typename Int, typename Alpha, typename Beta>
+        void dot(Int n, Alpha alpha, cl::Buffer x, Int incX, cl::Buffer y, Int incY, Beta beta,
+                 cl::Buffer result, backend::OpenCL) {
+            // A dot product is a 1x1 matrix product, with x passed as a transposed column
+            gemm(true,
+                 false,
+                 Int(1),
+                 Int(1),
+                 n,
+                 alpha,
+                 x,
+                 incX,
+                 y,
+                 incY,
+                 beta,
+                 result,
+                 Int(1),
+                 backend::OpenCL());
+        }
+
+#endif // LIBRAPID_HAS_OPENCL
+
+#if defined(LIBRAPID_HAS_CUDA)
+
+        template<typename Int, typename Alpha, typename X, typename Y, typename Beta, typename R>
+        void dot(Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY, Beta beta, R *result,
+                 backend::CUDA) {
+            // As with gemv, the product is passed through to cuBLAS LT MatMul, with x as a
+            // transposed column
+            gemm(true,
+                 false,
+                 Int(1),
+                 Int(1),
+                 n,
+                 alpha,
+                 x,
+                 incX,
+                 y,
+                 incY,
+                 beta,
+                 result,
+                 Int(1),
+                 backend::CUDA());
+        }
+
+#endif // LIBRAPID_HAS_CUDA
+    } // namespace linalg
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
@@ -0,0 +1,173 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
+
+namespace librapid {
+    namespace detail::cpu {
+        /// Columns of the outer product written per block. A block of \f$ \mathbf{y} \f$ stays
+        /// in the L1 cache while it is reused for every row.
+        constexpr int64_t gerBlockColumns = 2048;
+
+        /// Write rows [first, last) of \f$ \mathbf{A} = \alpha \mathbf{x} \mathbf{y}^T + \beta
+        /// \mathbf{A} \f$, one block of columns at a time. Contiguous rows of a type with SIMD
+        /// support are written with packet operations. If \p beta is zero, \p a is not read.
+        template<typename Scalar, typename X, typename Y, typename A>
+        void gerRows(int64_t first, int64_t last, int64_t n, const Scalar &alpha, const X *x,
+                     int64_t incX, const Y *y, int64_t incY, const Scalar &beta, A *a,
+                     int64_t lda) {
+            using Info               = typetraits::TypeInfo<Scalar>;
+            constexpr bool vectorise = std::is_same_v<X, Scalar> && std::is_same_v<Y, Scalar> &&
+                                       std::is_same_v<A, Scalar> && Info::allowVectorisation &&
+                                       Info::packetWidth > 1;
+
+            const bool betaZero = beta == Scalar(0);
+
+            for (int64_t jb = 0; jb < n; jb += gerBlockColumns) {
+                const int64_t columns = std::min(gerBlockColumns, n - jb);
+                const Y *yBlock       = y + jb * incY;
+
+                for (int64_t i = first; i < last; ++i) {
+                    const Scalar scale = alpha * Scalar(x[i * incX]);
+                    A *row             = a + i * lda + jb;
+                    int64_t j          = 0;
+
+                    if constexpr (vectorise) {
+                        if (incY == 1) {
+                            using Packet        = typename Info::Packet;
+                            constexpr int64_t W = Info::packetWidth;
+                            const Packet scalePacket(scale);
+                            const Packet betaPacket(beta);
+
+                            if (betaZero) {
+                                for (; j + W <= columns; j += W) {
+                                    (scalePacket * xsimd::load_unaligned(yBlock + j))
+                                      .store_unaligned(row + j);
+                                }
+                            } else {
+                                for (; j + W <= columns; j += W) {
+                                    const Packet old = betaPacket * xsimd::load_unaligned(row + j);
+                                    xsimd::fma(scalePacket, xsimd::load_unaligned(yBlock + j), old)
+                                      .store_unaligned(row + j);
+                                }
+                            }
+                        }
+                    }
+
+                    for (; j < columns; ++j) {
+                        const Scalar product = scale * Scalar(yBlock[j * incY]);
+                        row[j] = static_cast<A>(betaZero ? product : product + beta * row[j]);
+                    }
+                }
+            }
+        }
+    } // namespace detail::cpu
+
+    namespace linalg {
+        /// \brief Outer product (general rank-1 update)
+        ///
+        /// Computes \f$ \mathbf{A} = \alpha \mathbf{x} \mathbf{y}^T + \beta \mathbf{A} \f$ for
+        /// vectors \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$ and an \f$ m \times n \f$ row-major
+        /// matrix \f$ \mathbf{A} \f$. Unlike the BLAS routine, this includes a \f$ \beta \f$
+        /// term. If \f$ \beta \f$ is zero, \f$ \mathbf{A} \f$ is not read, so a plain outer
+        /// product writes every element exactly once.
+        ///
+        /// On the CPU, large products are split into blocks of rows, which are written in
+        /// parallel.
+        /// \tparam Int Integer type
+        /// \tparam Alpha Alpha scaling factor
+        /// \tparam X First vector type
+        /// \tparam Y Second vector type
+        /// \tparam Beta Beta scaling factor
+        /// \tparam A Matrix type
+        /// \param m Number of elements in \f$ \mathbf{x} \f$ (rows of \f$ \mathbf{A} \f$)
+        /// \param n Number of elements in \f$ \mathbf{y} \f$ (columns of \f$ \mathbf{A} \f$)
+        /// \param alpha Scaling factor for \f$ \mathbf{x} \mathbf{y}^T \f$
+        /// \param x Pointer to vector \f$ \mathbf{x} \f$
+        /// \param incX Increment of \f$ \mathbf{x} \f$
+        /// \param y Pointer to vector \f$ \mathbf{y} \f$
+        /// \param incY Increment of \f$ \mathbf{y} \f$
+        /// \param beta Scaling factor for \f$ \mathbf{A} \f$
+        /// \param a Pointer to matrix \f$ \mathbf{A} \f$
+        /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+        /// \param backend Backend to use for computation
+        template<typename Int, typename Alpha, typename X, typename Y, typename Beta, typename A>
+        void ger(Int m, Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY, Beta beta, A *a,
+                 Int lda, backend::CPU backend = backend::CPU()) {
+            using Scalar = decltype(std::declval<X>() * std::declval<Y>());
+
+            const auto rows        = static_cast<int64_t>(m);
+            const auto cols        = static_cast<int64_t>(n);
+            const auto inX         = static_cast<int64_t>(incX);
+            const auto inY         = static_cast<int64_t>(incY);
+            const auto ldA         = static_cast<int64_t>(lda);
+            const auto alphaScalar = static_cast<Scalar>(alpha);
+            const auto betaScalar  = static_cast<Scalar>(beta);
+
+            auto writeRows = [&](int64_t first, int64_t last) {
+                detail::cpu::gerRows(
+                  first, last, cols, alphaScalar, x, inX, y, inY, betaScalar, a, ldA);
+            };
+
+            // Calls from inside a parallel region would run serially anyway
+            if (global::numThreads > 1 && rows > 1 &&
+                rows * cols > static_cast<int64_t>(global::multithreadThreshold) &&
+                !detail::ThreadPool::inParallelRegion()) {
+                parallelFor(0, rows, writeRows);
+                return;
+            }
+
+            writeRows(0, rows);
+        }
+
+#if defined(LIBRAPID_HAS_OPENCL)
+
+        template<typename Int, typename Alpha, typename Beta>
+        void ger(Int m, Int n, Alpha alpha, cl::Buffer x, Int incX, cl::Buffer y, Int incY,
+                 Beta beta, cl::Buffer a, Int lda, backend::OpenCL) {
+            // An outer product is a matrix product with an inner dimension of one, with y
+            // passed as a transposed column
+            gemm(false,
+                 true,
+                 m,
+                 n,
+                 Int(1),
+                 alpha,
+                 x,
+                 incX,
+                 y,
+                 incY,
+                 beta,
+                 a,
+                 lda,
+                 backend::OpenCL());
+        }
+
+#endif // LIBRAPID_HAS_OPENCL
+
+#if defined(LIBRAPID_HAS_CUDA)
+
+        template<typename Int, typename Alpha, typename X, typename Y, typename Beta, typename A>
+        void ger(Int m, Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY, Beta beta, A *a,
+                 Int lda, backend::CUDA) {
+            // As with gemv, the product is passed through to cuBLAS LT MatMul, with an inner
+            // dimension of one
+            gemm(false,
+                 true,
+                 m,
+                 n,
+                 Int(1),
+                 alpha,
+                 x,
+                 incX,
+                 y,
+                 incY,
+                 beta,
+                 a,
+                 lda,
+                 backend::CUDA());
+        }
+
+#endif // LIBRAPID_HAS_CUDA
+    } // namespace linalg
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
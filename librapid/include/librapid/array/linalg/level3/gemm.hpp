@@ -9,6 +9,11 @@ namespace librapid::linalg {
     /// for matrices \f$ \mathbf{A} \f$, \f$ \mathbf{B} \f$ and \f$ \mathbf{C} \f$.
     /// \f$ \mathrm{OP}_A \f$ and \f$ \mathrm{OP}_B \f$ are
     /// either the identity or the transpose operation.
+    ///
+    /// On the CPU, BLAS is used for the types it supports, if it is available. Otherwise, a
+    /// packed, cache-blocked kernel is used, which is vectorised for any type with SIMD support
+    /// and runs on LibRapid's thread pool once \f$ n \f$ reaches
+    /// global::gemmMultithreadThreshold.
     /// \tparam Int Integer type for matrix dimensions
     /// \tparam Alpha Type of \f$ \alpha \f$
     /// \tparam A Type of \f$ \mathbf{A} \f$
@@ -48,6 +53,221 @@ namespace librapid::linalg {
                       ldc);
     }
 
+    /// \brief General matrix-matrix multiplication with a fused epilogue
+    ///
+    /// Computes \f$ \mathbf{C} = f(\alpha \mathrm{OP}_A(\mathbf{A}) \mathrm{OP}_B(\mathbf{B}) +
+    /// \beta \mathbf{C}) \f$, where \f$ f \f$ is an element-wise epilogue (see epilogue.hpp).
+    ///
+    /// LibRapid's own kernel applies the epilogue to each tile of \f$ \mathbf{C} \f$ as soon
+    /// as the tile is final, on the thread which computed it, while it is still in the L1
+    /// cache. Types which are multiplied by BLAS are computed in blocks of rows which fit in
+    /// the L2 cache instead (but are no shorter than detail::cpu::epilogueMinRows). The blocks
+    /// are computed one after another, so BLAS can use its own threads for each of them, and
+    /// the epilogue is applied to each block as soon as it has been written.
+    /// \tparam Epilogue Type of the epilogue
+    /// \param epilogue The epilogue, called as `epilogue(value, row, col)`, or as
+    /// `epilogue.packet(value, row, col)` for a packet of elements if it has a packet form
+    /// \see gemm
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C,
+             typename Epilogue>
+    void gemmEpilogue(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda,
+                      B *b, Int ldb, Beta beta, C *c, Int ldc, const Epilogue &epilogue,
+                      backend::CPU backend = backend::CPU()) {
+        using ScalarA = std::remove_const_t<A>;
+        constexpr bool blas = cxxblas::GemmUsesBlas<ScalarA>::value &&
+                              std::is_same_v<ScalarA, std::remove_const_t<B>> &&
+                              std::is_same_v<ScalarA, C>;
+
+        if constexpr (typetraits::IsNoEpilogue<Epilogue>::value) {
+            gemm(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, backend);
+        } else if constexpr (blas) {
+            const auto rows = static_cast<int64_t>(m);
+            const auto cols = static_cast<int64_t>(n);
+            const auto ldA  = static_cast<int64_t>(lda);
+            const auto ldC  = static_cast<int64_t>(ldc);
+            const int64_t blockRows =
+              detail::cpu::epilogueBlockRows(rows, cols, static_cast<int64_t>(sizeof(C)));
+
+            for (int64_t first = 0; first < rows; first += blockRows) {
+                const int64_t last = std::min(rows, first + blockRows);
+
+                // Row i of OP(A) is column i of A if A is transposed
+                A *aBlock = transA ? a + first : a + first * ldA;
+                gemm(transA,
+                     transB,
+                     static_cast<Int>(last - first),
+                     n,
+                     k,
+                     alpha,
+                     aBlock,
+                     lda,
+                     b,
+                     ldb,
+                     beta,
+                     c + first * ldC,
+                     ldc,
+                     backend);
+
+                detail::cpu::applyEpilogue(c, ldC, first, last, cols, epilogue);
+            }
+        } else {
+            auto applyToTile = [&epilogue](C *tile,
+                                           int64_t ldTile,
+                                           int64_t row,
+                                           int64_t col,
+                                           int64_t tileRows,
+                                           int64_t tileCols) {
+                detail::cpu::applyEpilogueTile(
+                  tile, ldTile, row, col, tileRows, tileCols, epilogue);
+            };
+
+            cxxblas::gemm_fused(transA ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans,
+                                transB ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                a,
+                                lda,
+                                b,
+                                ldb,
+                                beta,
+                                c,
+                                ldc,
+                                applyToTile);
+        }
+    }
+
+    /// \brief Batched general matrix-matrix multiplication
+    ///
+    /// Computes \f$ \mathbf{C}_i = \alpha \mathrm{OP}_A(\mathbf{A}_i) \mathrm{OP}_B(\mathbf{B}_i) +
+    /// \beta \mathbf{C}_i \f$ for \f$ i = 0, \ldots, \mathrm{batch} - 1 \f$, where matrix
+    /// \f$ i \f$ of each operand starts \f$ i \times \mathrm{stride} \f$ elements after the
+    /// first one. A stride of zero uses the same matrix in every product.
+    ///
+    /// If every product uses the same \f$ \mathbf{B} \f$ and the matrices of
+    /// \f$ \mathbf{A} \f$ and \f$ \mathbf{C} \f$ are stored one after another, the batch is
+    /// computed as a single, taller product. Otherwise, small products are distributed over
+    /// the thread pool, while large products are each parallelised internally.
+    /// \tparam Int Integer type for matrix dimensions
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam A Type of \f$ \mathbf{A} \f$
+    /// \tparam B Type of \f$ \mathbf{B} \f$
+    /// \tparam Beta Type of \f$ \beta \f$
+    /// \tparam C Type of \f$ \mathbf{C} \f$
+    /// \param transA Whether to transpose each \f$ \mathbf{A}_i \f$
+    /// \param transB Whether to transpose each \f$ \mathbf{B}_i \f$
+    /// \param m Rows of each \f$ \mathrm{OP}_A(\mathbf{A}_i) \f$ and \f$ \mathbf{C}_i \f$
+    /// \param n Columns of each \f$ \mathrm{OP}_B(\mathbf{B}_i) \f$ and \f$ \mathbf{C}_i \f$
+    /// \param k Columns of each \f$ \mathrm{OP}_A(\mathbf{A}_i) \f$ and rows of each
+    /// \f$ \mathrm{OP}_B(\mathbf{B}_i) \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param a Pointer to \f$ \mathbf{A}_0 \f$
+    /// \param lda Leading dimension of each \f$ \mathbf{A}_i \f$
+    /// \param strideA Distance between consecutive matrices of \f$ \mathbf{A} \f$
+    /// \param b Pointer to \f$ \mathbf{B}_0 \f$
+    /// \param ldb Leading dimension of each \f$ \mathbf{B}_i \f$
+    /// \param strideB Distance between consecutive matrices of \f$ \mathbf{B} \f$
+    /// \param beta Scalar \f$ \beta \f$
+    /// \param c Pointer to \f$ \mathbf{C}_0 \f$
+    /// \param ldc Leading dimension of each \f$ \mathbf{C}_i \f$
+    /// \param strideC Distance between consecutive matrices of \f$ \mathbf{C} \f$
+    /// \param batch Number of products
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda,
+                     Int strideA, B *b, Int ldb, Int strideB, Beta beta, C *c, Int ldc,
+                     Int strideC, Int batch, backend::CPU backend = backend::CPU()) {
+        if (batch == 0) return;
+
+        // [batch, m, k] x [k, n] is the same as [batch * m, k] x [k, n]
+        if (strideB == 0 && !transA && strideA == m * lda && strideC == m * ldc) {
+            gemm(transA, transB, m * batch, n, k, alpha, a, lda, b, ldb, beta, c, ldc, backend);
+            return;
+        }
+
+#if defined(LIBRAPID_BLAS_MKL) && defined(INTEL_MKL_VERSION) && INTEL_MKL_VERSION >= 20200002
+        using GemmScalar = std::remove_const_t<A>;
+        constexpr bool sameType =
+          std::is_same_v<GemmScalar, std::remove_const_t<B>> && std::is_same_v<GemmScalar, C>;
+
+        if constexpr (sameType && std::is_same_v<GemmScalar, float>) {
+            cblas_sgemm_batch_strided(CblasRowMajor,
+                                      transA ? CblasTrans : CblasNoTrans,
+                                      transB ? CblasTrans : CblasNoTrans,
+                                      m,
+                                      n,
+                                      k,
+                                      static_cast<float>(alpha),
+                                      a,
+                                      lda,
+                                      strideA,
+                                      b,
+                                      ldb,
+                                      strideB,
+                                      static_cast<float>(beta),
+                                      c,
+                                      ldc,
+                                      strideC,
+                                      batch);
+            return;
+        } else if constexpr (sameType && std::is_same_v<GemmScalar, double>) {
+            cblas_dgemm_batch_strided(CblasRowMajor,
+                                      transA ? CblasTrans : CblasNoTrans,
+                                      transB ? CblasTrans : CblasNoTrans,
+                                      m,
+                                      n,
+                                      k,
+                                      static_cast<double>(alpha),
+                                      a,
+                                      lda,
+                                      strideA,
+                                      b,
+                                      ldb,
+                                      strideB,
+                                      static_cast<double>(beta),
+                                      c,
+                                      ldc,
+                                      strideC,
+                                      batch);
+            return;
+        }
+#endif // LIBRAPID_BLAS_MKL
+
+        auto multiply = [&](int64_t i) {
+            gemm(transA,
+                 transB,
+                 m,
+                 n,
+                 k,
+                 alpha,
+                 a + i * strideA,
+                 lda,
+                 b + i * strideB,
+                 ldb,
+                 beta,
+                 c + i * strideC,
+                 ldc,
+                 backend);
+        };
+
+        // Split the batch between the threads if each product is too small to be parallelised
+        // by itself, or if there are enough products to keep every thread busy. The products
+        // then run serially, since they are inside a parallel region
+        const auto work = static_cast<size_t>(batch) * static_cast<size_t>(m) *
+                          static_cast<size_t>(n) * static_cast<size_t>(k);
+        const bool parallelBatch =
+          global::numThreads > 1 && batch > 1 && work >= global::multithreadThreshold &&
+          (static_cast<size_t>(n) < global::gemmMultithreadThreshold ||
+           static_cast<size_t>(batch) >= global::numThreads);
+
+        if (parallelBatch) {
+            parallelFor(0, static_cast<int64_t>(batch), multiply);
+        } else {
+            for (int64_t i = 0; i < static_cast<int64_t>(batch); ++i) multiply(i);
+        }
+    }
+
 #if defined(LIBRAPID_HAS_OPENCL)
 
     template<typename Int, typename Alpha, typename Beta>
@@ -112,6 +332,52 @@ namespace librapid::linalg {
         }
     }
 
+    template<typename Int, typename Alpha, typename Beta>
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, cl::Buffer a,
+                     Int lda, Int strideA, cl::Buffer b, Int ldb, Int strideB, Beta beta,
+                     cl::Buffer c, Int ldc, Int strideC, Int batch, backend::OpenCL backend) {
+        using GemmScalar = decltype(alpha * beta);
+
+        if (batch == 1) {
+            gemm(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, backend);
+            return;
+        }
+
+        if constexpr (typetraits::IsBlasType<GemmScalar>::value) {
+            auto status = clblast::GemmStridedBatched<GemmScalar>(
+              clblast::Layout::kRowMajor,
+              (transA ? clblast::Transpose::kYes : clblast::Transpose::kNo),
+              (transB ? clblast::Transpose::kYes : clblast::Transpose::kNo),
+              m,
+              n,
+              k,
+              alpha,
+              a(),
+              0,
+              lda,
+              strideA,
+              b(),
+              0,
+              ldb,
+              strideB,
+              beta,
+              c(),
+              0,
+              ldc,
+              strideC,
+              batch,
+              &global::openCLQueue());
+
+            LIBRAPID_ASSERT(status == clblast::StatusCode::kSuccess,
+                            "clblast::GemmStridedBatched failed: {}",
+                            opencl::getCLBlastErrorString(status));
+        } else {
+            // The fallback kernel cannot operate on an offset into a buffer
+            LIBRAPID_ERROR("Batched matrix multiplication of {} is not supported with OpenCL",
+                           typetraits::TypeInfo<GemmScalar>::name);
+        }
+    }
+
 #endif // LIBRAPID_HAS_OPENCL
 
 #if defined(LIBRAPID_HAS_CUDA)
@@ -164,8 +430,9 @@ namespace librapid::linalg {
     }
 
     template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
-    void gemm(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda, B *b,
-              Int ldb, Beta beta, C *c, Int ldc, backend::CUDA) {
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda,
+                     Int strideA, B *b, Int ldb, Int strideB, Beta beta, C *c, Int ldc,
+                     Int strideC, Int batch, backend::CUDA) {
         if constexpr (typetraits::IsBlasType<A>::value && typetraits::IsBlasType<B>::value &&
                       typetraits::IsBlasType<C>::value) {
             // Using the cuBLAS LT API
@@ -216,6 +483,28 @@ namespace librapid::linalg {
             cublasSafeCall(cublasLtMatrixLayoutSetAttribute(
               descriptorC, CUBLASLT_MATRIX_LAYOUT_ORDER, &order, sizeof(order)));
 
+            // Describe the batch, if there is one. A stride of zero reuses the same matrix
+            if (batch > 1) {
+                const auto batchCount   = static_cast<int32_t>(batch);
+                const int64_t strides[] = {static_cast<int64_t>(strideA),
+                                           static_cast<int64_t>(strideB),
+                                           static_cast<int64_t>(strideC)};
+                cublasLtMatrixLayout_t descriptors[] = {descriptorA, descriptorB, descriptorC};
+
+                for (int i = 0; i < 3; ++i) {
+                    cublasSafeCall(
+                      cublasLtMatrixLayoutSetAttribute(descriptors[i],
+                                                       CUBLASLT_MATRIX_LAYOUT_BATCH_COUNT,
+                                                       &batchCount,
+                                                       sizeof(batchCount)));
+                    cublasSafeCall(
+                      cublasLtMatrixLayoutSetAttribute(descriptors[i],
+                                                       CUBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                                       &strides[i],
+                                                       sizeof(strides[i])));
+                }
+            }
+
             // Create preference handle
             cublasSafeCall(cublasLtMatmulPreferenceCreate(&preference));
             cublasSafeCall(
@@ -285,18 +574,41 @@ namespace librapid::linalg {
             dim3 threadsPerBlock(TS, TS);
             dim3 numBlocks((n + TS - 1) / TS, (m + TS - 1) / TS);
 
-            jitifyCall(program.kernel("gemm")
-                         .instantiate(jitify::reflection::Type<Int>(),
-                                      jitify::reflection::Type<Alpha>(),
-                                      jitify::reflection::Type<A>(),
-                                      jitify::reflection::Type<Beta>(),
-                                      jitify::reflection::Type<B>(),
-                                      jitify::reflection::Type<C>())
-                         .configure(numBlocks, threadsPerBlock, 0, global::cudaStream)
-                         .launch(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc));
+            auto kernel = program.kernel("gemm").instantiate(jitify::reflection::Type<Int>(),
+                                                             jitify::reflection::Type<Alpha>(),
+                                                             jitify::reflection::Type<A>(),
+                                                             jitify::reflection::Type<Beta>(),
+                                                             jitify::reflection::Type<B>(),
+                                                             jitify::reflection::Type<C>());
+
+            // The fallback kernel computes one product at a time
+            for (Int i = 0; i < batch; ++i) {
+                jitifyCall(kernel.configure(numBlocks, threadsPerBlock, 0, global::cudaStream)
+                             .launch(transA,
+                                     transB,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     a + i * strideA,
+                                     lda,
+                                     b + i * strideB,
+                                     ldb,
+                                     beta,
+                                     c + i * strideC,
+                                     ldc));
+            }
         }
     }
 
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemm(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda, B *b,
+              Int ldb, Beta beta, C *c, Int ldc, backend::CUDA backend) {
+        gemmBatched(
+          transA, transB, m, n, k, alpha, a, lda, Int(0), b, ldb, Int(0), beta, c, ldc, Int(0),
+          Int(1), backend);
+    }
+
 #endif // LIBRAPID_HAS_CUDA
 } // namespace librapid::linalg
 
@@ -21,11 +21,16 @@ namespace librapid::typetraits {
     struct IsBlasType<Complex<double>> : std::true_type {};
 } // namespace librapid::typetraits
 
+#include "epilogue.hpp"
+#include "fixedSize.hpp" // Unrolled kernels used by transpose and arrayMultiply
 #include "transpose.hpp"
 
-#include "level3/gemm.hpp" // Included before gemv, since gemm is used in some gemv implementations
+#include "level3/gemm.hpp" // Included first, since dot, gemv and ger use gemm on the GPU
+
+#include "level1/dot.hpp"
 
 #include "level2/gemv.hpp"
+#include "level2/ger.hpp"
 
 #include "level3/geam.hpp"
 
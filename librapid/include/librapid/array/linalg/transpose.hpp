@@ -10,12 +10,24 @@ namespace librapid {
 			using Backend	  = typename TypeInfo<std::decay_t<T>>::Backend;
 			using ShapeType	  = typename TypeInfo<std::decay_t<T>>::ShapeType;
 			using StorageType = typename TypeInfo<std::decay_t<T>>::StorageType;
-			static constexpr bool allowVectorisation = false;
+
+			// Transposes of CPU arrays can be loaded packet-by-packet, by gathering each packet
+			// from the input with the stride of the result's innermost dimension
+			static constexpr bool allowVectorisation =
+			  IsArrayContainer<std::decay_t<T>>::value &&
+			  std::is_same_v<StorageType, Storage<Scalar>> && TypeInfo<Scalar>::allowVectorisation;
 		};
 
 		LIBRAPID_DEFINE_AS_TYPE(typename T, array::Transpose<T>);
 	} // namespace typetraits
 
+	namespace detail {
+		template<typename T>
+		struct IsArrayType<array::Transpose<T>> {
+			static constexpr bool val = true;
+		};
+	} // namespace detail
+
 	namespace kernels {
 #if defined(LIBRAPID_NATIVE_ARCH)
 #	if !defined(LIBRAPID_APPLE) && LIBRAPID_ARCH >= ARCH_AVX2
@@ -239,23 +251,8 @@ namespace librapid {
 			LIBRAPID_ALWAYS_INLINE void
 			transposeImpl(Scalar *__restrict out, const Scalar *__restrict in, int64_t rows,
 						  int64_t cols, Alpha alpha, int64_t blockSize) {
-#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#	pragma omp parallel for shared(rows, cols, blockSize, in, out, alpha) default(none)           \
-	  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-								for (int64_t col = j; col < j + blockSize && col < cols; ++col) {
-									out[col * rows + row] = in[row * cols + col] * alpha;
-								}
-							}
-						}
-					}
-				} else
-#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
-				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
+				auto transposeRows = [&](int64_t first, int64_t last) {
+					for (int64_t i = first; i < last; i += blockSize) {
 						for (int64_t j = 0; j < cols; j += blockSize) {
 							for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
 								for (int64_t col = j; col < j + blockSize && col < cols; ++col) {
@@ -264,7 +261,16 @@ namespace librapid {
 							}
 						}
 					}
+				};
+
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+				if (rows * cols > global::multithreadThreshold) {
+					parallelFor(0, rows, transposeRows, blockSize);
+					return;
 				}
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+
+				transposeRows(0, rows);
 			}
 
 #if LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
@@ -274,29 +280,8 @@ namespace librapid {
 													  int64_t) {
 				constexpr int64_t blockSize = LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE;
 
-#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#		pragma omp parallel for shared(rows, cols, in, out, alpha) default(none)                  \
-		  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeFloatKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col];
-									}
-								}
-							}
-						}
-					}
-				} else
-#	endif
-				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
+				auto transposeRows = [&](int64_t first, int64_t last) {
+					for (int64_t i = first; i < last; i += blockSize) {
 						for (int64_t j = 0; j < cols; j += blockSize) {
 							if (i + blockSize <= rows && j + blockSize <= cols) {
 								kernels::transposeFloatKernel(
@@ -311,7 +296,16 @@ namespace librapid {
 							}
 						}
 					}
+				};
+
+#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+				if (rows * cols > global::multithreadThreshold) {
+					parallelFor(0, rows, transposeRows, blockSize);
+					return;
 				}
+#	endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+
+				transposeRows(0, rows);
 			}
 #endif // LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
 
@@ -322,29 +316,8 @@ namespace librapid {
 													  int64_t) {
 				constexpr int64_t blockSize = LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE;
 
-#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#		pragma omp parallel for shared(rows, cols, in, out, alpha) default(none)                  \
-		  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeDoubleKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col] * alpha;
-									}
-								}
-							}
-						}
-					}
-				} else
-#	endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
-				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
+				auto transposeRows = [&](int64_t first, int64_t last) {
+					for (int64_t i = first; i < last; i += blockSize) {
 						for (int64_t j = 0; j < cols; j += blockSize) {
 							if (i + blockSize <= rows && j + blockSize <= cols) {
 								kernels::transposeDoubleKernel(
@@ -359,7 +332,16 @@ namespace librapid {
 							}
 						}
 					}
+				};
+
+#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+				if (rows * cols > global::multithreadThreshold) {
+					parallelFor(0, rows, transposeRows, blockSize);
+					return;
 				}
+#	endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+
+				transposeRows(0, rows);
 			}
 #endif // LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE > 0
 		} // namespace cpu
@@ -543,6 +525,14 @@ namespace librapid {
 			/// \return Scalar type at the given index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalar(int64_t index) const;
 
+			/// Load a packet of elements starting at a given index in the object. Consecutive
+			/// elements of a row of the result are a fixed distance apart in the input, so a
+			/// packet which lies within one row is gathered with that stride. This is only
+			/// available for transposes of CPU arrays.
+			/// \param index Index of the first element of the packet
+			/// \return Packet starting at the given index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(int64_t index) const;
+
 			/// \brief Return the axes of the Transpose object
 			/// \return `ShapeType` containing the axes
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const ShapeType &axes() const;
@@ -572,11 +562,17 @@ namespace librapid {
 											Ctx &ctx) const;
 
 		private:
+			/// Convert an index into the result into the corresponding index into the input
+			/// \param index Index into the result
+			/// \return Index into the input
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t inputIndex(int64_t index) const;
+
 			ArrayType m_array;
 			ShapeType m_inputShape;
 			ShapeType m_outputShape;
 			size_t m_outputSize;
 			ShapeType m_axes;
+			ShapeType m_inputStride; // Row-major strides of the input, used by scalar()
 			Scalar m_alpha;
 		};
 
@@ -593,6 +589,13 @@ namespace librapid {
 			}
 
 			m_outputSize = m_outputShape.size();
+
+			m_inputStride = ShapeType::zeros(m_inputShape.ndim());
+			size_t step	  = 1;
+			for (int64_t i = m_inputShape.ndim() - 1; i >= 0; --i) {
+				m_inputStride[i] = step;
+				step *= m_inputShape[i];
+			}
 		}
 
 		template<typename T>
@@ -612,8 +615,49 @@ namespace librapid {
 
 		template<typename T>
 		auto Transpose<T>::scalar(int64_t index) const -> auto {
-			// TODO: This is a heinously inefficient way of doing this. Fix it.
-			return eval().scalar(index);
+			if constexpr (isArray && isHost) {
+				return static_cast<Scalar>(m_array.scalar(inputIndex(index)) * m_alpha);
+			} else {
+				// TODO: This is a heinously inefficient way of doing this. Fix it.
+				return eval().scalar(index);
+			}
+		}
+
+		template<typename T>
+		auto Transpose<T>::packet(int64_t index) const -> auto {
+			static_assert(typetraits::TypeInfo<Transpose>::allowVectorisation,
+						  "Packet loads are only supported for transposes of CPU arrays");
+
+			using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			const int64_t dims			  = ndim();
+
+			if (dims == 0) return Packet(scalar(0));
+
+			const int64_t innerExtent = m_outputShape[dims - 1];
+			if ((index % innerExtent) + packetWidth <= innerExtent) LIBRAPID_LIKELY {
+					const Scalar *first	 = m_array.storage().data() + inputIndex(index);
+					const int64_t stride = m_inputStride[m_axes[dims - 1]];
+					return detail::gatherStrided<Packet>(first, stride) * Packet(m_alpha);
+				}
+
+			// The packet spans multiple rows
+			alignas(LIBRAPID_MEM_ALIGN) Scalar buffer[packetWidth];
+			for (int64_t lane = 0; lane < packetWidth; ++lane) {
+				buffer[lane] = scalar(index + lane);
+			}
+			return Packet::load_aligned(buffer);
+		}
+
+		template<typename T>
+		auto Transpose<T>::inputIndex(int64_t index) const -> int64_t {
+			int64_t result = 0;
+			for (int64_t i = ndim() - 1; i >= 0; --i) {
+				const int64_t extent = m_outputShape[i];
+				result += (index % extent) * m_inputStride[m_axes[i]];
+				index /= extent;
+			}
+			return result;
 		}
 
 		template<typename T>
@@ -645,16 +689,29 @@ namespace librapid {
 
 			if constexpr (isArray) {
 				if constexpr (isHost) {
-					auto *__restrict outPtr = out.storage().begin();
-					auto *__restrict inPtr	= m_array.storage().begin();
-					int64_t blockSize		= global::cacheLineSize / sizeof(Scalar);
+					using Fixed = typetraits::FixedMatrixInfo<typename BaseType::StorageType>;
+
+					if constexpr (Fixed::value &&
+								  Fixed::rows <= detail::cpu::maxUnrolledDimension &&
+								  Fixed::cols <= detail::cpu::maxUnrolledDimension) {
+						// Small fixed-size matrices are transposed with a fully unrolled kernel
+						detail::cpu::fixedTranspose<Fixed::rows, Fixed::cols>(
+						  out.storage().data(), m_array.storage().data(), m_alpha);
+					} else {
+						auto *__restrict outPtr = out.storage().data();
+						auto *__restrict inPtr	= m_array.storage().data();
+						int64_t blockSize		= global::cacheLineSize / sizeof(Scalar);
 
-					if (m_inputShape.ndim() == 2) {
-						detail::cpu::transposeImpl(
-						  outPtr, inPtr, m_inputShape[0], m_inputShape[1], m_alpha, blockSize);
+						if (m_inputShape.ndim() == 2) {
+							detail::cpu::transposeImpl(
+							  outPtr, inPtr, m_inputShape[0], m_inputShape[1], m_alpha, blockSize);
 
-					} else {
-						LIBRAPID_NOT_IMPLEMENTED
+						} else {
+							// Any other permutation is gathered one element at a time
+							for (int64_t i = 0; i < static_cast<int64_t>(m_outputSize); ++i) {
+								outPtr[i] = static_cast<Scalar>(inPtr[inputIndex(i)] * m_alpha);
+							}
+						}
 					}
 				}
 #if defined(LIBRAPID_HAS_OPENCL)
@@ -692,10 +749,21 @@ namespace librapid {
 		auto Transpose<T>::eval() const {
 			if constexpr (typetraits::TypeInfo<BaseType>::type ==
 						  detail::LibRapidType::ArrayContainer) {
-				using NonConstArrayType = std::remove_const_t<BaseType>;
-				NonConstArrayType res(m_outputShape);
-				applyTo(res);
-				return res;
+				using Fixed = typetraits::FixedMatrixInfo<typename BaseType::StorageType>;
+
+				if constexpr (Fixed::value) {
+					// The transpose of a fixed-size matrix is a fixed-size matrix with the
+					// dimensions swapped, so nothing is allocated
+					using ResultStorage = FixedStorage<Scalar, Fixed::cols, Fixed::rows>;
+					ArrayContainer<ShapeType, ResultStorage> res(m_outputShape, ResultStorage());
+					applyTo(res);
+					return res;
+				} else {
+					using NonConstArrayType = std::remove_const_t<BaseType>;
+					NonConstArrayType res(m_outputShape);
+					applyTo(res);
+					return res;
+				}
 			} else {
 				auto tmp   = m_array.eval();
 				using Type = decltype(tmp);
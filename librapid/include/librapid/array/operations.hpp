@@ -28,6 +28,12 @@
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,                   \
 															  const Packet &rhs) const {           \
 			return Packet(lhs OP_ rhs);                                                            \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mask(const Packet &lhs,                     \
+															const Packet &rhs) const {             \
+			return lhs OP_ rhs;                                                                    \
 		}                                                                                          \
 	}
 
@@ -91,15 +97,30 @@
 	  const std::tuple<First, Second> &tup) {                                                      \
 		if constexpr (IsArrayType<std::decay_t<First>>::value) {                                   \
 			if constexpr (IsArrayType<std::decay_t<Second>>::value) {                              \
-				LIBRAPID_ASSERT_WITH_EXCEPTION(                                                    \
-				  std::range_error,                                                                \
-				  std::get<0>(tup).shape() == std::get<1>(tup).shape(),                            \
-				  "Shapes must match for binary operations. {} vs {}",                             \
-				  std::get<0>(tup).shape(),                                                        \
-				  std::get<1>(tup).shape());                                                       \
+				using FirstInfo	 = TypeInfo<std::decay_t<First>>;                                  \
+				using SecondInfo = TypeInfo<std::decay_t<Second>>;                                 \
+				using ResultShape =                                                                \
+				  typename detail::ShapeTypeHelper<typename FirstInfo::ShapeType,                  \
+												   typename SecondInfo::ShapeType>::Type;          \
+                                                                                                   \
+				/* Broadcasting is only supported on the CPU */                                    \
+				if constexpr (std::is_same_v<typename FirstInfo::Backend, backend::CPU> &&         \
+							  std::is_same_v<typename SecondInfo::Backend, backend::CPU>) {        \
+					return detail::broadcastShapes<ResultShape>(std::get<0>(tup).shape(),          \
+																std::get<1>(tup).shape());         \
+				} else {                                                                           \
+					LIBRAPID_ASSERT_WITH_EXCEPTION(                                                \
+					  std::range_error,                                                            \
+					  std::get<0>(tup).shape() == std::get<1>(tup).shape(),                        \
+					  "Shapes must match for binary operations. {} vs {}",                         \
+					  std::get<0>(tup).shape(),                                                    \
+					  std::get<1>(tup).shape());                                                   \
+					return detail::broadcastShapes<ResultShape>(std::get<0>(tup).shape(),          \
+																std::get<1>(tup).shape());         \
+				}                                                                                  \
+			} else {                                                                               \
 				return std::get<0>(tup).shape();                                                   \
 			}                                                                                      \
-			return std::get<0>(tup).shape();                                                       \
 		} else if constexpr (IsArrayType<std::decay_t<Second>>::value) {                           \
 			return std::get<1>(tup).shape();                                                       \
 		}                                                                                          \
@@ -112,6 +133,23 @@
 		return getShapeImpl(args);                                                                 \
 	}
 
+#define LIBRAPID_TERNARY_KERNEL_GETTER                                                             \
+	template<typename... Args>                                                                     \
+	static constexpr const char *getKernelName(std::tuple<Args...> args) {                         \
+		static_assert(sizeof...(Args) == 3, "Invalid number of arguments for ternary operation");  \
+		return kernelName;                                                                         \
+	}
+
+#define LIBRAPID_TERNARY_SHAPE_EXTRACTOR                                                           \
+	template<typename... Args>                                                                     \
+	LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE auto getShape(                                \
+	  const std::tuple<Args...> &args) {                                                           \
+		static_assert(sizeof...(Args) == 3, "Invalid number of arguments for ternary operation");  \
+		using ResultShape = typename detail::ShapeTypeHelper<                                      \
+		  typename TypeInfo<std::decay_t<Args>>::ShapeType...>::Type;                              \
+		return detail::broadcastArgumentShapes<ResultShape>(args);                                 \
+	}
+
 #define LIBRAPID_UNARY_FUNCTOR(NAME, OP)                                                           \
 	struct NAME {                                                                                  \
 		template<typename T>                                                                       \
@@ -153,6 +191,30 @@ namespace librapid {
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseEqual, ==);	 // a == b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseNotEqual, !=); // a != b
 
+		/// Elementwise selection between two values. A non-zero condition selects the first value,
+		/// and a zero condition selects the second.
+		struct Select {
+			template<typename C, typename T, typename V>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const C &cond, const T &lhs,
+																	  const V &rhs) const {
+				using Scalar = std::common_type_t<T, V>;
+				return cond ? static_cast<Scalar>(lhs) : static_cast<Scalar>(rhs);
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			packet(const Packet &cond, const Packet &lhs, const Packet &rhs) const {
+				return xsimd::select(cond != Packet(0), lhs, rhs);
+			}
+
+			/// Select between two packets using a mask produced directly by a comparison
+			template<typename Mask, typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			packetMasked(const Mask &mask, const Packet &lhs, const Packet &rhs) const {
+				return xsimd::select(mask, lhs, rhs);
+			}
+		};
+
 		LIBRAPID_UNARY_FUNCTOR(Sin, ::librapid::sin);	 // sin(a)
 		LIBRAPID_UNARY_FUNCTOR(Cos, ::librapid::cos);	 // cos(a)
 		LIBRAPID_UNARY_FUNCTOR(Tan, ::librapid::tan);	 // tan(a)
@@ -376,6 +438,15 @@ namespace librapid {
 			LIBRAPID_BINARY_SHAPE_EXTRACTOR
 		};
 
+		template<>
+		struct TypeInfo<::librapid::detail::Select> {
+			static constexpr const char *name		= "select";
+			static constexpr const char *filename	= "select";
+			static constexpr const char *kernelName = "selectArrays";
+			LIBRAPID_TERNARY_KERNEL_GETTER
+			LIBRAPID_TERNARY_SHAPE_EXTRACTOR
+		};
+
 		template<>
 		struct TypeInfo<::librapid::detail::Neg> {
 			static constexpr const char *name		= "negate";
@@ -657,8 +728,9 @@ namespace librapid {
 
 		/// \brief Element-wise array addition
 		///
-		/// Performs element-wise addition on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise addition on two arrays. Their shapes must either match or be
+		/// broadcastable (following the same rules as NumPy). Operands with different scalar types
+		/// are promoted following the usual C++ arithmetic conversions.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -668,22 +740,15 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator+(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Plus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
 
 		/// \brief Element-wise array subtraction
 		///
-		/// Performs element-wise subtraction on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise subtraction on two arrays. Their shapes must either match or be
+		/// broadcastable (following the same rules as NumPy). Operands with different scalar types
+		/// are promoted following the usual C++ arithmetic conversions.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -693,22 +758,15 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator-(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Minus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
 
 		/// \brief Element-wise array multiplication
 		///
-		/// Performs element-wise multiplication on two arrays. They must both be the same
-		/// size and of the same data type.
+		/// Performs element-wise multiplication on two arrays. Their shapes must either match or be
+		/// broadcastable (following the same rules as NumPy). Operands with different scalar types
+		/// are promoted following the usual C++ arithmetic conversions.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -718,22 +776,15 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator*(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Multiply>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
 
 		/// \brief Element-wise array division
 		///
-		/// Performs element-wise division on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise division on two arrays. Their shapes must either match or be
+		/// broadcastable (following the same rules as NumPy). Operands with different scalar types
+		/// are promoted following the usual C++ arithmetic conversions.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -743,14 +794,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator/(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Divide>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -758,9 +801,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a < b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is less
+		/// than the second. Their shapes must either match or be broadcastable (following the same
+		/// rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -770,14 +813,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator<(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::LessThan>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -785,9 +820,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a > b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is
+		/// greater than the second. Their shapes must either match or be broadcastable (following
+		/// the same rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -797,14 +832,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::GreaterThan>(std::forward<LHS>(lhs),
 															 std::forward<RHS>(rhs));
@@ -813,9 +840,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a <= b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than or equal to the second. They must both be the same size and of the
-		/// same data type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is less
+		/// than or equal to the second. Their shapes must either match or be broadcastable
+		/// (following the same rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -825,14 +852,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator<=(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::LessThanEqual>(std::forward<LHS>(lhs),
 															   std::forward<RHS>(rhs));
@@ -841,9 +860,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a >= b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than or equal to the second. They must both be the same size and of
-		/// the same data type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is
+		/// greater than or equal to the second. Their shapes must either match or be broadcastable
+		/// (following the same rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -853,14 +872,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>=(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::GreaterThanEqual>(std::forward<LHS>(lhs),
 																  std::forward<RHS>(rhs));
@@ -869,9 +880,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a == b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is equal
+		/// to the second. Their shapes must either match or be broadcastable (following the same
+		/// rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -881,14 +892,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator==(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::ElementWiseEqual>(std::forward<LHS>(lhs),
 																  std::forward<RHS>(rhs));
@@ -897,9 +900,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a != b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is not equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is not
+		/// equal to the second. Their shapes must either match or be broadcastable (following the
+		/// same rules as NumPy), and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -909,14 +912,6 @@ namespace librapid {
 		template<class LHS, class RHS>
 			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator!=(LHS &&lhs, RHS &&rhs) {
-			if constexpr (IS_ARRAY_OP_ARRAY) {
-				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
-											   lhs.shape(),
-											   rhs.shape());
-			}
-
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::ElementWiseNotEqual>(std::forward<LHS>(lhs),
 																	 std::forward<RHS>(rhs));
@@ -934,6 +929,54 @@ namespace librapid {
 		}
 	} // namespace array
 
+	/// \brief Select elements from one of two arrays, based on a condition
+	///
+	/// \f$R = \{ R_0, R_1, R_2, ... \} \f$ \text{ where } \f$R_i = C_i \neq 0 ? A_i : B_i\f$
+	///
+	/// The result is evaluated lazily, and is vectorised wherever possible. If the condition is
+	/// a comparison (e.g. `x > 0`), its result is used directly as a mask, so it is never
+	/// materialised as an array of zeros and ones:
+	///
+	/// \code{.cpp}
+	/// auto leakyRelu = lrc::where(x > 0, x, x * 0.01f);
+	/// auto clipped   = lrc::where(x > 1, 1.0f, x);
+	/// \endcode
+	///
+	/// The shapes of the condition and any array arguments must either match or be broadcastable
+	/// (following the same rules as NumPy). Either of \p lhs and \p rhs may also be a scalar.
+	/// This is currently only supported for arrays on the CPU.
+	///
+	/// \tparam Cond Type of the condition
+	/// \tparam LHS Type of the values selected where the condition is true
+	/// \tparam RHS Type of the values selected where the condition is false
+	/// \param cond The condition
+	/// \param lhs Values selected where the condition is non-zero
+	/// \param rhs Values selected where the condition is zero
+	/// \return Selection function object
+	template<class Cond, class LHS, class RHS>
+		requires(detail::isType<Cond,
+								detail::LibRapidType::ArrayContainer,
+								detail::LibRapidType::ArrayFunction,
+								detail::LibRapidType::GeneralArrayView>() &&
+				 detail::isType<LHS,
+								detail::LibRapidType::ArrayContainer,
+								detail::LibRapidType::ArrayFunction,
+								detail::LibRapidType::GeneralArrayView,
+								detail::LibRapidType::Scalar>() &&
+				 detail::isType<RHS,
+								detail::LibRapidType::ArrayContainer,
+								detail::LibRapidType::ArrayFunction,
+								detail::LibRapidType::GeneralArrayView,
+								detail::LibRapidType::Scalar>())
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto where(Cond &&cond, LHS &&lhs, RHS &&rhs) {
+		auto result =
+		  detail::makeFunction<typetraits::DescriptorType_t<Cond, LHS, RHS>, detail::Select>(
+			std::forward<Cond>(cond), std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		static_assert(std::is_same_v<typename decltype(result)::Backend, backend::CPU>,
+					  "where() is only supported for arrays on the CPU");
+		return result;
+	}
+
 	/// \brief Calculate the sine of each element in the array
 	///
 	/// \f$R = \{ R_0, R_1, R_2, ... \} \f$ \text{ where } \f$R_i = \sin(A_i)\f$
@@ -0,0 +1,97 @@
+#ifndef LIBRAPID_ARRAY_PARALLEL_THRESHOLD_HPP
+#define LIBRAPID_ARRAY_PARALLEL_THRESHOLD_HPP
+
+namespace librapid::detail {
+	/// The largest number of elements evaluated when measuring the cost of an expression
+	constexpr size_t calibrationSampleSize = 8192;
+
+	/// Expressions with fewer elements than this are not measured, since the timings would be
+	/// dominated by noise
+	constexpr size_t calibrationMinimumSize = 1024;
+
+	/// Measure the serial cost of evaluating an elementwise expression, by evaluating the first
+	/// \p sample elements into a temporary buffer several times and keeping the fastest run
+	/// \tparam T The type of the expression
+	/// \param function The expression to measure
+	/// \param sample The number of elements to evaluate
+	/// \return The cost of evaluating a single element, in nanoseconds
+	template<typename T>
+	LIBRAPID_NODISCARD double measureElementCost(const T &function, size_t sample) {
+		using Scalar			 = typename typetraits::TypeInfo<T>::Scalar;
+		constexpr bool vectorise = typetraits::TypeInfo<T>::allowVectorisation &&
+								   typetraits::TypeInfo<Scalar>::packetWidth > 1;
+
+		std::vector<Scalar> sink(sample);
+		double best = std::numeric_limits<double>::max();
+
+		for (int repeat = 0; repeat < 5; ++repeat) {
+			const double start = now<time::nanosecond>();
+			size_t index	   = 0;
+
+			if constexpr (vectorise) {
+				constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+				for (; index + packetWidth <= sample; index += packetWidth) {
+					function.packet(index).store_unaligned(sink.data() + index);
+				}
+			}
+
+			for (; index < sample; ++index) { sink[index] = function.scalar(index); }
+
+			best = std::min(best, now<time::nanosecond>() - start);
+		}
+
+		return best / static_cast<double>(sample);
+	}
+
+	/// Return the number of elements above which an object should be evaluated in parallel.
+	///
+	/// For elementwise expressions, this is calibrated for each expression type the first time
+	/// it is evaluated (see calibration.hpp), unless global::calibrateThresholds is false. For
+	/// anything else, global::multithreadThreshold is used.
+	/// \tparam T The type of the object
+	/// \param val The object being evaluated
+	/// \return The threshold, in elements
+	template<typename T>
+	LIBRAPID_NODISCARD auto parallelThreshold(const T &val) -> size_t {
+		if constexpr (!std::is_same_v<typename typetraits::TypeInfo<T>::Backend, backend::CPU> ||
+					  typetraits::TypeInfo<T>::type != LibRapidType::ArrayFunction) {
+			return global::multithreadThreshold;
+		} else if constexpr (typetraits::HasCustomEval<T>::value) {
+			return global::multithreadThreshold;
+		} else {
+			// Measurements taken inside a parallel region would be meaningless, since the thread
+			// pool runs nested jobs serially
+			if (!global::calibrateThresholds || ThreadPool::inParallelRegion()) {
+				return global::multithreadThreshold;
+			}
+
+			static std::atomic<size_t> threshold {0};
+			static std::atomic<uint64_t> thresholdEpoch {0};
+
+			const uint64_t epoch = calibration::epoch();
+			size_t result		 = threshold.load(std::memory_order_relaxed);
+			const bool cached =
+			  result != 0 && thresholdEpoch.load(std::memory_order_relaxed) == epoch;
+			if (cached) LIBRAPID_LIKELY { return result; }
+
+			const std::string key = typeid(T).name();
+			result				  = calibration::lookup(key);
+
+			if (result == 0) {
+				const size_t size = val.size();
+				if (size < calibrationMinimumSize) return global::multithreadThreshold;
+
+				const double cost =
+				  measureElementCost(val, std::min(size, calibrationSampleSize));
+				result = calibration::thresholdFromCost(cost);
+				calibration::store(key, result);
+			}
+
+			thresholdEpoch.store(epoch, std::memory_order_relaxed);
+			threshold.store(result, std::memory_order_relaxed);
+			return result;
+		}
+	}
+} // namespace librapid::detail
+
+#endif // LIBRAPID_ARRAY_PARALLEL_THRESHOLD_HPP
@@ -0,0 +1,867 @@
+#ifndef LIBRAPID_ARRAY_REDUCTIONS_HPP
+#define LIBRAPID_ARRAY_REDUCTIONS_HPP
+
+namespace librapid {
+	namespace detail {
+		namespace reduction {
+			/// Reduction operation computing the sum of a set of values
+			struct Sum {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T identity() {
+					return T(0);
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T combine(const T &lhs,
+																		   const T &rhs) {
+					return lhs + rhs;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &lhs, const Packet &rhs) {
+					return lhs + rhs;
+				}
+			};
+
+			/// Reduction operation computing the product of a set of values
+			struct Prod {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T identity() {
+					return T(1);
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T combine(const T &lhs,
+																		   const T &rhs) {
+					return lhs * rhs;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &lhs, const Packet &rhs) {
+					return lhs * rhs;
+				}
+			};
+
+			/// Reduction operation computing the smallest of a set of values
+			struct Min {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T identity() {
+					if constexpr (std::numeric_limits<T>::has_infinity) {
+						return std::numeric_limits<T>::infinity();
+					} else {
+						return std::numeric_limits<T>::max();
+					}
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T combine(const T &lhs,
+																		   const T &rhs) {
+					return rhs < lhs ? rhs : lhs;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &lhs, const Packet &rhs) {
+					return xsimd::min(lhs, rhs);
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static bool better(const T &candidate,
+																			 const T &best) {
+					return candidate < best;
+				}
+			};
+
+			/// Reduction operation computing the largest of a set of values
+			struct Max {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T identity() {
+					if constexpr (std::numeric_limits<T>::has_infinity) {
+						return -std::numeric_limits<T>::infinity();
+					} else {
+						return std::numeric_limits<T>::lowest();
+					}
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static T combine(const T &lhs,
+																		   const T &rhs) {
+					return rhs > lhs ? rhs : lhs;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &lhs, const Packet &rhs) {
+					return xsimd::max(lhs, rhs);
+				}
+
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static bool better(const T &candidate,
+																			 const T &best) {
+					return candidate > best;
+				}
+			};
+		} // namespace reduction
+
+		/// Information about how an object can be reduced. Array containers and general array
+		/// views are read directly, as are trivial Function objects (i.e. elementwise expressions
+		/// with no custom evaluation). Anything else is evaluated into a temporary first.
+		/// \tparam T The type of the object being reduced
+		template<typename T>
+		struct ReductionTraits {
+			using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+
+			static constexpr bool direct =
+			  typetraits::TypeInfo<T>::type == LibRapidType::ArrayContainer ||
+			  typetraits::TypeInfo<T>::type == LibRapidType::GeneralArrayView;
+
+			static constexpr bool vectorise =
+			  direct && typetraits::TypeInfo<T>::allowVectorisation &&
+			  typetraits::TypeInfo<Scalar>::packetWidth > 1;
+		};
+
+		template<typename Functor_, typename... Args>
+		struct ReductionTraits<Function<descriptor::Trivial, Functor_, Args...>> {
+			using Type	 = Function<descriptor::Trivial, Functor_, Args...>;
+			using Scalar = typename typetraits::TypeInfo<Type>::Scalar;
+
+			static constexpr bool direct = !typetraits::HasCustomEval<Type>::value;
+
+			static constexpr bool vectorise =
+			  direct && typetraits::TypeInfo<Type>::allowVectorisation &&
+			  typetraits::TypeInfo<Scalar>::packetWidth > 1;
+		};
+
+		/// Combine the elements of a packet into a single scalar value
+		/// \tparam Reducer The reduction operation
+		/// \tparam Packet The packet type
+		/// \param packet The packet to reduce
+		/// \return The combined value of every element in the packet
+		template<typename Reducer, typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto horizontalReduce(const Packet &packet) {
+			using Scalar = typename Packet::value_type;
+			Scalar buffer[Packet::size];
+			packet.store_unaligned(buffer);
+
+			Scalar result = buffer[0];
+			for (size_t i = 1; i < Packet::size; ++i) {
+				result = Reducer::combine(result, buffer[i]);
+			}
+			return result;
+		}
+
+		/// The number of pieces a parallel reduction or scan of \p elements elements is split
+		/// into. There are several pieces per thread, so the thread pool can balance uneven
+		/// progress by stealing whole pieces. The pieces depend only on the size of the range
+		/// and the number of threads, so floating point results do not depend on the schedule.
+		/// \param elements The number of elements to split
+		/// \param packetWidth Every piece contains at least this many elements
+		/// \return The number of pieces
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t parallelPieces(size_t elements,
+																		size_t packetWidth = 1) {
+			constexpr int64_t piecesPerThread = 4;
+			const int64_t pieces = static_cast<int64_t>(global::numThreads) * piecesPerThread;
+			return std::clamp<int64_t>(static_cast<int64_t>(elements / packetWidth), 1, pieces);
+		}
+
+		/// Combine a set of partial results pairwise, which keeps the rounding error of floating
+		/// point sums proportional to the logarithm of the number of partials. The first
+		/// element of the vector holds the result on return.
+		/// \tparam Reducer The reduction operation
+		/// \tparam Scalar The scalar type
+		/// \param partials The partial results to combine
+		/// \return The combined result
+		template<typename Reducer, typename Scalar>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar treeCombine(std::vector<Scalar> &partials) {
+			for (size_t stride = 1; stride < partials.size(); stride *= 2) {
+				for (size_t i = 0; i + stride < partials.size(); i += 2 * stride) {
+					partials[i] = Reducer::combine(partials[i], partials[i + stride]);
+				}
+			}
+			return partials[0];
+		}
+
+		/// Reduce the elements in the range [start, end) of an array-like object into a single
+		/// value. When vectorisation is enabled, the bulk of the range is processed with packet
+		/// loads into two independent accumulators.
+		/// \tparam Reducer The reduction operation
+		/// \tparam Vectorise If true, use packet operations where possible
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to reduce
+		/// \param start The first (linear) index to include
+		/// \param end One past the last (linear) index to include
+		/// \return The reduced value
+		template<typename Reducer, bool Vectorise, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto reduceRange(const T &val, size_t start,
+																   size_t end) {
+			using Scalar  = typename ReductionTraits<T>::Scalar;
+			Scalar result = Reducer::template identity<Scalar>();
+			size_t index  = start;
+
+			if constexpr (Vectorise) {
+				using Packet				 = typename typetraits::TypeInfo<Scalar>::Packet;
+				constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+				// Packet loads must start on a packet boundary, so the first few elements may need
+				// to be handled individually
+				const size_t alignedStart =
+				  std::min(end, (start + packetWidth - 1) / packetWidth * packetWidth);
+				const size_t vectorEnd =
+				  alignedStart + (end - alignedStart) / packetWidth * packetWidth;
+
+				for (; index < alignedStart; ++index) {
+					result = Reducer::combine(result, Scalar(val.scalar(index)));
+				}
+
+				if (index < vectorEnd) {
+					Packet acc0(Reducer::template identity<Scalar>());
+					Packet acc1 = acc0;
+
+					for (; index + 2 * packetWidth <= vectorEnd; index += 2 * packetWidth) {
+						acc0 = Reducer::combinePacket(acc0, val.packet(index));
+						acc1 = Reducer::combinePacket(acc1, val.packet(index + packetWidth));
+					}
+
+					if (index < vectorEnd) {
+						acc0 = Reducer::combinePacket(acc0, val.packet(index));
+						index += packetWidth;
+					}
+
+					result = Reducer::combine(
+					  result, horizontalReduce<Reducer>(Reducer::combinePacket(acc0, acc1)));
+				}
+			}
+
+			for (; index < end; ++index) {
+				result = Reducer::combine(result, Scalar(val.scalar(index)));
+			}
+
+			return result;
+		}
+
+		/// Reduce the elements in the range [start, end) of an array-like object, splitting the
+		/// work between threads if the range is large enough.
+		/// \see reduceRange
+		template<typename Reducer, bool Vectorise, typename T>
+		LIBRAPID_NODISCARD auto reduceRangeParallel(const T &val, size_t start, size_t end) {
+			using Scalar = typename ReductionTraits<T>::Scalar;
+
+			const size_t elements = end - start;
+			if (global::numThreads > 1 && elements > parallelThreshold(val)) {
+				constexpr size_t packetWidth = []() {
+					if constexpr (Vectorise) {
+						return typetraits::TypeInfo<Scalar>::packetWidth;
+					} else {
+						return 1;
+					}
+				}();
+
+				const int64_t pieces = parallelPieces(elements, packetWidth);
+
+				// Round pieces up to a whole number of packets so each piece's packet loads
+				// remain aligned
+				const size_t chunk =
+				  ((elements + pieces - 1) / pieces + packetWidth - 1) / packetWidth * packetWidth;
+
+				std::vector<Scalar> partials(pieces, Reducer::template identity<Scalar>());
+
+				parallelFor(0, pieces, [&](int64_t piece) {
+					const size_t first = std::min(end, start + size_t(piece) * chunk);
+					const size_t last  = std::min(end, first + chunk);
+					partials[piece]	   = reduceRange<Reducer, Vectorise>(val, first, last);
+				});
+
+				return treeCombine<Reducer>(partials);
+			}
+
+			return reduceRange<Reducer, Vectorise>(val, start, end);
+		}
+
+		/// Reduce a block of an array-like object viewed as a three-dimensional
+		/// [outer, reduced, inner] array along its middle dimension, accumulating into \p dst.
+		///
+		/// Only the elements [reducedBegin, reducedEnd) of the reduced dimension and
+		/// [innerBegin, innerEnd) of the inner dimension are processed. The inner dimension is
+		/// contiguous, so it is processed with packet loads where possible.
+		/// \tparam Reducer The reduction operation
+		/// \tparam Vectorise If true, use packet operations where possible
+		/// \param val The object to reduce
+		/// \param dst Pointer to the output row for this outer index (\p inner elements)
+		/// \param outer Index into the outer dimension
+		/// \param reduced Extent of the reduced dimension
+		/// \param inner Extent of the inner dimension
+		template<typename Reducer, bool Vectorise, typename T, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void reduceAxisBlock(const T &val, Scalar *dst, size_t outer,
+													size_t reduced, size_t inner,
+													size_t reducedBegin, size_t reducedEnd,
+													size_t innerBegin, size_t innerEnd) {
+			if (inner == 1) {
+				const size_t base = outer * reduced;
+				dst[0] =
+				  reduceRange<Reducer, Vectorise>(val, base + reducedBegin, base + reducedEnd);
+				return;
+			}
+
+			for (size_t j = innerBegin; j < innerEnd; ++j) {
+				dst[j] = Reducer::template identity<Scalar>();
+			}
+
+			for (size_t r = reducedBegin; r < reducedEnd; ++r) {
+				const size_t base = (outer * reduced + r) * inner;
+				size_t j		  = innerBegin;
+
+				if constexpr (Vectorise) {
+					using Packet				 = typename typetraits::TypeInfo<Scalar>::Packet;
+					constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					const size_t alignedBegin = std::min(
+					  innerEnd,
+					  (base + innerBegin + packetWidth - 1) / packetWidth * packetWidth - base);
+					const size_t vectorEnd =
+					  alignedBegin + (innerEnd - alignedBegin) / packetWidth * packetWidth;
+
+					for (; j < alignedBegin; ++j) {
+						dst[j] = Reducer::combine(dst[j], Scalar(val.scalar(base + j)));
+					}
+
+					for (; j < vectorEnd; j += packetWidth) {
+						Packet acc = Packet::load_unaligned(dst + j);
+						Reducer::combinePacket(acc, val.packet(base + j)).store_unaligned(dst + j);
+					}
+				}
+
+				for (; j < innerEnd; ++j) {
+					dst[j] = Reducer::combine(dst[j], Scalar(val.scalar(base + j)));
+				}
+			}
+		}
+
+		/// Normalise a list of axes for an array with \p ndim dimensions, wrapping negative
+		/// values, sorting the result and removing duplicates.
+		/// \param axes The axes to normalise
+		/// \param ndim The number of dimensions of the array
+		/// \return The normalised axes
+		LIBRAPID_NODISCARD inline auto normaliseReductionAxes(std::vector<int64_t> axes,
+															  int64_t ndim)
+		  -> std::vector<int64_t> {
+			for (auto &axis : axes) {
+				if (axis < 0) axis += ndim;
+				LIBRAPID_ASSERT_WITH_EXCEPTION(std::out_of_range,
+											   axis >= 0 && axis < ndim,
+											   "Axis {} is out of range for an array with {} "
+											   "dimensions",
+											   axis,
+											   ndim);
+			}
+
+			std::sort(axes.begin(), axes.end());
+			axes.erase(std::unique(axes.begin(), axes.end()), axes.end());
+			return axes;
+		}
+
+		/// Reduce an array-like object along the contiguous range of axes [first, last]. The
+		/// object is treated as an [outer, reduced, inner] array and the work is split into
+		/// cache-sized blocks of the output, which are distributed between threads. If there are
+		/// too few output blocks to keep every thread busy, the reduced dimension is split
+		/// instead and the per-thread partial results are combined afterwards.
+		/// \tparam Reducer The reduction operation
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to reduce
+		/// \param first The first axis to reduce
+		/// \param last The last axis to reduce (inclusive)
+		/// \return An array containing the result
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto reduceAxisRange(const T &val, int64_t first, int64_t last) {
+			using Scalar				  = typename ReductionTraits<T>::Scalar;
+			constexpr bool vectorise	  = ReductionTraits<T>::vectorise;
+			constexpr size_t packetWidth = []() {
+				if constexpr (vectorise) {
+					return typetraits::TypeInfo<Scalar>::packetWidth;
+				} else {
+					return 1;
+				}
+			}();
+
+			const auto shape   = val.shape();
+			const int64_t ndim = shape.ndim();
+
+			size_t outer = 1, reduced = 1, inner = 1;
+			std::vector<int64_t> resultShape;
+			for (int64_t i = 0; i < ndim; ++i) {
+				if (i < first) {
+					outer *= shape[i];
+					resultShape.push_back(shape[i]);
+				} else if (i <= last) {
+					reduced *= shape[i];
+				} else {
+					inner *= shape[i];
+					resultShape.push_back(shape[i]);
+				}
+			}
+			if (resultShape.empty()) resultShape.push_back(1);
+
+			Array<Scalar, backend::CPU> result(Shape(resultShape));
+			Scalar *out = result.storage().begin();
+
+			// Process the inner dimension in blocks small enough for the output row to stay in
+			// the L1 cache while the reduced dimension is traversed
+			const size_t blockSize =
+			  std::max(packetWidth, size_t(16384 / sizeof(Scalar)) / packetWidth * packetWidth);
+			const size_t innerBlocks = inner == 1 ? 1 : (inner + blockSize - 1) / blockSize;
+			const int64_t tasks		 = static_cast<int64_t>(outer * innerBlocks);
+
+			auto runTask = [&](int64_t task) {
+				const size_t o			= size_t(task) / innerBlocks;
+				const size_t innerBegin = (size_t(task) % innerBlocks) * blockSize;
+				const size_t innerEnd	= std::min(inner, innerBegin + blockSize);
+				reduceAxisBlock<Reducer, vectorise>(
+				  val, out + o * inner, o, reduced, inner, 0, reduced, innerBegin, innerEnd);
+			};
+
+			if (outer * reduced * inner > global::multithreadThreshold &&
+				global::numThreads > 1) {
+				const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+
+				if (tasks >= numThreads) {
+					parallelFor(0, tasks, runTask);
+					return result;
+				}
+
+				const int64_t pieces	 = parallelPieces(reduced);
+				const size_t rowElements = outer * inner;
+				const size_t chunk		 = (reduced + pieces - 1) / pieces;
+				std::vector<Scalar> partials(pieces * rowElements);
+
+				parallelFor(0, pieces, [&](int64_t piece) {
+					const size_t reducedBegin = std::min(reduced, size_t(piece) * chunk);
+					const size_t reducedEnd	  = std::min(reduced, reducedBegin + chunk);
+					Scalar *dst				  = partials.data() + piece * rowElements;
+
+					for (size_t o = 0; o < outer; ++o) {
+						reduceAxisBlock<Reducer, vectorise>(val,
+															dst + o * inner,
+															o,
+															reduced,
+															inner,
+															reducedBegin,
+															reducedEnd,
+															0,
+															inner);
+					}
+				});
+
+				// Combine the rows of the pieces pairwise
+				for (int64_t stride = 1; stride < pieces; stride *= 2) {
+					for (int64_t i = 0; i + stride < pieces; i += 2 * stride) {
+						Scalar *lhs		  = partials.data() + i * rowElements;
+						const Scalar *rhs = partials.data() + (i + stride) * rowElements;
+						for (size_t e = 0; e < rowElements; ++e) {
+							lhs[e] = Reducer::combine(lhs[e], rhs[e]);
+						}
+					}
+				}
+
+				std::copy(partials.begin(), partials.begin() + rowElements, out);
+				return result;
+			}
+
+			for (int64_t task = 0; task < tasks; ++task) { runTask(task); }
+			return result;
+		}
+
+		/// Reduce every element of an array-like object into a single value
+		/// \tparam Reducer The reduction operation
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to reduce
+		/// \return The reduced value
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto reduceAll(const T &val) {
+			using Type = std::decay_t<T>;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Reductions are only supported for arrays on the CPU backend");
+
+			if constexpr (ReductionTraits<Type>::direct) {
+				return reduceRangeParallel<Reducer, ReductionTraits<Type>::vectorise>(
+				  val, 0, val.shape().size());
+			} else {
+				return reduceAll<Reducer>(val.eval());
+			}
+		}
+
+		/// Reduce an array-like object along one or more axes. Adjacent axes are merged into a
+		/// single reduction. Only the first group of axes is reduced directly from \p val; any
+		/// further groups reduce the (much smaller) intermediate result.
+		/// \tparam Reducer The reduction operation
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to reduce
+		/// \param axes The axes to reduce along
+		/// \return An array containing the result
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto reduceAxes(const T &val, const std::vector<int64_t> &axes) {
+			using Type	 = std::decay_t<T>;
+			using Scalar = typename typetraits::TypeInfo<Type>::Scalar;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Reductions are only supported for arrays on the CPU backend");
+
+			if constexpr (!ReductionTraits<Type>::direct) {
+				return reduceAxes<Reducer>(val.eval(), axes);
+			} else {
+				auto normalised = normaliseReductionAxes(axes, val.shape().ndim());
+				LIBRAPID_ASSERT(!normalised.empty(), "At least one axis must be specified");
+
+				// Reduce the highest group of adjacent axes first so the indices of the
+				// remaining groups are unaffected
+				int64_t last  = normalised.back();
+				int64_t first = last;
+				size_t index  = normalised.size() - 1;
+				while (index > 0 && normalised[index - 1] == first - 1) {
+					--index;
+					--first;
+				}
+
+				Array<Scalar, backend::CPU> result = reduceAxisRange<Reducer>(val, first, last);
+
+				while (index > 0) {
+					last  = normalised[index - 1];
+					first = last;
+					--index;
+					while (index > 0 && normalised[index - 1] == first - 1) {
+						--index;
+						--first;
+					}
+					result = reduceAxisRange<Reducer>(result, first, last);
+				}
+
+				return result;
+			}
+		}
+
+		/// Find the linear index of the best element (as defined by \p Compare) of an array-like
+		/// object. If several elements compare equal, the first is returned.
+		/// \tparam Compare The reduction operation providing the comparison
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to search
+		/// \return The index of the best element
+		template<typename Compare, typename T>
+		LIBRAPID_NODISCARD auto argReduceAll(const T &val) -> int64_t {
+			using Type = std::decay_t<T>;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Reductions are only supported for arrays on the CPU backend");
+
+			if constexpr (!ReductionTraits<Type>::direct) {
+				return argReduceAll<Compare>(val.eval());
+			} else {
+				using Scalar	   = typename ReductionTraits<Type>::Scalar;
+				const int64_t size = static_cast<int64_t>(val.shape().size());
+				LIBRAPID_ASSERT(size > 0, "Cannot find the best element of an empty array");
+
+				auto search = [&](int64_t first, int64_t last) {
+					Scalar best		  = val.scalar(first);
+					int64_t bestIndex = first;
+					for (int64_t index = first + 1; index < last; ++index) {
+						Scalar value = val.scalar(index);
+						if (Compare::better(value, best)) {
+							best	  = value;
+							bestIndex = index;
+						}
+					}
+					return std::make_pair(best, bestIndex);
+				};
+
+				if (size > int64_t(global::multithreadThreshold) && global::numThreads > 1) {
+					const int64_t pieces = parallelPieces(size_t(size));
+					const int64_t chunk	 = (size + pieces - 1) / pieces;
+					std::vector<std::pair<Scalar, int64_t>> partials(pieces);
+
+					parallelFor(0, pieces, [&](int64_t piece) {
+						const int64_t first = std::min(size, piece * chunk);
+						const int64_t last	= std::min(size, first + chunk);
+						if (first < last) partials[piece] = search(first, last);
+					});
+
+					// Combine in order so ties resolve to the first occurrence
+					auto result = partials[0];
+					for (int64_t piece = 1; piece < pieces; ++piece) {
+						if (piece * chunk >= size) break;
+						if (Compare::better(partials[piece].first, result.first)) {
+							result = partials[piece];
+						}
+					}
+					return result.second;
+				}
+
+				return search(0, size).second;
+			}
+		}
+
+		/// Find the index of the best element (as defined by \p Compare) along a single axis of
+		/// an array-like object
+		/// \tparam Compare The reduction operation providing the comparison
+		/// \tparam T The type of the object being reduced
+		/// \param val The object to search
+		/// \param axis The axis to search along
+		/// \return An array of indices into \p axis
+		template<typename Compare, typename T>
+		LIBRAPID_NODISCARD auto argReduceAxis(const T &val, int64_t axis) {
+			using Type = std::decay_t<T>;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Reductions are only supported for arrays on the CPU backend");
+
+			if constexpr (!ReductionTraits<Type>::direct) {
+				return argReduceAxis<Compare>(val.eval(), axis);
+			} else {
+				using Scalar	   = typename ReductionTraits<Type>::Scalar;
+				const auto shape   = val.shape();
+				const int64_t ndim = shape.ndim();
+				axis			   = normaliseReductionAxes({axis}, ndim)[0];
+
+				size_t outer = 1, reduced = shape[axis], inner = 1;
+				std::vector<int64_t> resultShape;
+				for (int64_t i = 0; i < ndim; ++i) {
+					if (i == axis) continue;
+					(i < axis ? outer : inner) *= shape[i];
+					resultShape.push_back(shape[i]);
+				}
+				if (resultShape.empty()) resultShape.push_back(1);
+
+				LIBRAPID_ASSERT(reduced > 0, "Cannot find the best element of an empty axis");
+
+				Array<int64_t, backend::CPU> result(Shape(resultShape));
+				int64_t *out = result.storage().begin();
+
+				// Traverse each [reduced, inner] slab row by row so reads stay contiguous
+				auto runTask = [&](int64_t o) {
+					std::vector<Scalar> best(inner);
+					int64_t *dst = out + o * inner;
+					for (size_t j = 0; j < inner; ++j) {
+						best[j] = val.scalar(o * reduced * inner + j);
+						dst[j]	= 0;
+					}
+
+					for (size_t r = 1; r < reduced; ++r) {
+						const size_t base = (o * reduced + r) * inner;
+						for (size_t j = 0; j < inner; ++j) {
+							Scalar value = val.scalar(base + j);
+							if (Compare::better(value, best[j])) {
+								best[j] = value;
+								dst[j]	= int64_t(r);
+							}
+						}
+					}
+				};
+
+				if (outer * reduced * inner > global::multithreadThreshold &&
+					global::numThreads > 1 && outer > 1) {
+					parallelFor(0, static_cast<int64_t>(outer), runTask);
+					return result;
+				}
+
+				for (int64_t o = 0; o < int64_t(outer); ++o) { runTask(o); }
+				return result;
+			}
+		}
+	} // namespace detail
+
+	/// \brief Compute the sum of every element in an array
+	///
+	/// Array expressions are reduced directly, without being evaluated into a temporary array.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \return \f$ \sum_i x_i \f$
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto sum(const T &val) {
+		return detail::reduceAll<detail::reduction::Sum>(val);
+	}
+
+	/// \brief Compute the sum of an array along the given axes
+	///
+	/// Negative axes count from the last dimension. The reduced dimensions are removed from the
+	/// shape of the result.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \param axes The axes to sum along
+	/// \return An array containing the sums
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto sum(const T &val,
+													   const std::vector<int64_t> &axes) {
+		return detail::reduceAxes<detail::reduction::Sum>(val, axes);
+	}
+
+	/// \brief Compute the sum of an array along a single axis
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto sum(const T &val, int64_t axis) {
+		return detail::reduceAxes<detail::reduction::Sum>(val, {axis});
+	}
+
+	/// \brief Compute the product of every element in an array
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \return \f$ \prod_i x_i \f$
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto prod(const T &val) {
+		return detail::reduceAll<detail::reduction::Prod>(val);
+	}
+
+	/// \brief Compute the product of an array along the given axes
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto prod(const T &val,
+														const std::vector<int64_t> &axes) {
+		return detail::reduceAxes<detail::reduction::Prod>(val, axes);
+	}
+
+	/// \brief Compute the product of an array along a single axis
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto prod(const T &val, int64_t axis) {
+		return detail::reduceAxes<detail::reduction::Prod>(val, {axis});
+	}
+
+	/// \brief Find the smallest element in an array
+	///
+	/// This is named `amin` rather than `min` to avoid clashing with the variadic
+	/// \p librapid::min function.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \return The smallest element of \p val
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amin(const T &val) {
+		return detail::reduceAll<detail::reduction::Min>(val);
+	}
+
+	/// \brief Find the smallest elements of an array along the given axes
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amin(const T &val,
+														const std::vector<int64_t> &axes) {
+		return detail::reduceAxes<detail::reduction::Min>(val, axes);
+	}
+
+	/// \brief Find the smallest elements of an array along a single axis
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amin(const T &val, int64_t axis) {
+		return detail::reduceAxes<detail::reduction::Min>(val, {axis});
+	}
+
+	/// \brief Find the largest element in an array
+	///
+	/// This is named `amax` rather than `max` to avoid clashing with the variadic
+	/// \p librapid::max function.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \return The largest element of \p val
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amax(const T &val) {
+		return detail::reduceAll<detail::reduction::Max>(val);
+	}
+
+	/// \brief Find the largest elements of an array along the given axes
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amax(const T &val,
+														const std::vector<int64_t> &axes) {
+		return detail::reduceAxes<detail::reduction::Max>(val, axes);
+	}
+
+	/// \brief Find the largest elements of an array along a single axis
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto amax(const T &val, int64_t axis) {
+		return detail::reduceAxes<detail::reduction::Max>(val, {axis});
+	}
+
+	/// \brief Compute the arithmetic mean of every element in an array
+	///
+	/// The result has the same scalar type as the input, so the mean of an integer array is
+	/// truncated.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to reduce
+	/// \return \f$ \frac{1}{n} \sum_i x_i \f$
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mean(const T &val) {
+		using Scalar = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+		return detail::reduceAll<detail::reduction::Sum>(val) / Scalar(val.shape().size());
+	}
+
+	/// \brief Compute the arithmetic mean of an array along the given axes
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mean(const T &val,
+														const std::vector<int64_t> &axes) {
+		using Scalar = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+		auto result	 = detail::reduceAxes<detail::reduction::Sum>(val, axes);
+		result		 = result / Scalar(val.shape().size() / result.shape().size());
+		return result;
+	}
+
+	/// \brief Compute the arithmetic mean of an array along a single axis
+	/// \see sum(const T &, const std::vector<int64_t> &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto mean(const T &val, int64_t axis) {
+		return mean(val, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Find the linear index of the largest element in an array
+	///
+	/// If several elements share the largest value, the index of the first is returned.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to search
+	/// \return The index of the largest element
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto argmax(const T &val) -> int64_t {
+		return detail::argReduceAll<detail::reduction::Max>(val);
+	}
+
+	/// \brief Find the indices of the largest elements along an axis of an array
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to search
+	/// \param axis The axis to search along
+	/// \return An array of indices into \p axis
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto argmax(const T &val, int64_t axis) {
+		return detail::argReduceAxis<detail::reduction::Max>(val, axis);
+	}
+
+	/// \brief Find the linear index of the smallest element in an array
+	/// \see argmax(const T &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto argmin(const T &val) -> int64_t {
+		return detail::argReduceAll<detail::reduction::Min>(val);
+	}
+
+	/// \brief Find the indices of the smallest elements along an axis of an array
+	/// \see argmax(const T &, int64_t)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto argmin(const T &val, int64_t axis) {
+		return detail::argReduceAxis<detail::reduction::Min>(val, axis);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_REDUCTIONS_HPP
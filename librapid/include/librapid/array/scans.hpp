@@ -0,0 +1,415 @@
+#ifndef LIBRAPID_ARRAY_SCANS_HPP
+#define LIBRAPID_ARRAY_SCANS_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Compute the inclusive scan of the elements of a packet, entirely in registers. This
+		/// takes log2(packet width) shift-and-combine steps. Lanes shifted in from below are
+		/// filled with the identity of the operation.
+		/// \tparam Reducer The operation to scan with
+		/// \tparam Shift The number of lanes to shift by in this step
+		/// \tparam Packet The packet type
+		/// \param x The packet to scan
+		/// \param identity A packet filled with the identity of the operation
+		/// \return The inclusive scan of \p x
+		template<typename Reducer, size_t Shift = 1, typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		packetInclusiveScan(const Packet &x, const Packet &identity) {
+			if constexpr (Shift >= Packet::size) {
+				return x;
+			} else {
+				using Scalar				 = typename Packet::value_type;
+				constexpr size_t shiftBytes = Shift * sizeof(Scalar);
+				constexpr size_t fillBytes	 = (Packet::size - Shift) * sizeof(Scalar);
+
+				// The two halves have no set bits in common, so OR-ing them is exact
+				const Packet shifted =
+				  xsimd::slide_left<shiftBytes>(x) | xsimd::slide_right<fillBytes>(identity);
+				return packetInclusiveScan<Reducer, Shift * 2>(Reducer::combinePacket(x, shifted),
+															   identity);
+			}
+		}
+
+		/// Compute the inclusive scan of the elements in the range [start, end) of an
+		/// array-like object, continuing from \p carry. The results are written to the same
+		/// (linear) indices of \p dst.
+		/// \tparam Reducer The operation to scan with
+		/// \tparam Vectorise If true, use packet operations where possible
+		/// \tparam T The type of the object being scanned
+		/// \tparam Scalar The scalar type of the result
+		/// \param val The object to scan
+		/// \param dst The output
+		/// \param start The first (linear) index to scan
+		/// \param end One past the last (linear) index to scan
+		/// \param carry The combined value of every element before \p start
+		/// \return The combined value of every element up to and including \p end - 1
+		template<typename Reducer, bool Vectorise, typename T, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE Scalar scanRange(const T &val, Scalar *dst, size_t start,
+												size_t end, Scalar carry) {
+			size_t index = start;
+
+			if constexpr (Vectorise) {
+				using Packet				 = typename typetraits::TypeInfo<Scalar>::Packet;
+				constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+				// Packet loads must start on a packet boundary
+				const size_t alignedStart =
+				  std::min(end, (start + packetWidth - 1) / packetWidth * packetWidth);
+				const size_t vectorEnd =
+				  alignedStart + (end - alignedStart) / packetWidth * packetWidth;
+
+				for (; index < alignedStart; ++index) {
+					carry	   = Reducer::combine(carry, Scalar(val.scalar(index)));
+					dst[index] = carry;
+				}
+
+				const Packet identity(Reducer::template identity<Scalar>());
+				for (; index < vectorEnd; index += packetWidth) {
+					const Packet scanned = Reducer::combinePacket(
+					  Packet(carry), packetInclusiveScan<Reducer>(val.packet(index), identity));
+					scanned.store_unaligned(dst + index);
+					carry = dst[index + packetWidth - 1];
+				}
+			}
+
+			for (; index < end; ++index) {
+				carry	   = Reducer::combine(carry, Scalar(val.scalar(index)));
+				dst[index] = carry;
+			}
+
+			return carry;
+		}
+
+		/// Combine every element in the range [start, end) of \p dst with \p carry
+		/// \tparam Reducer The operation to scan with
+		/// \tparam Vectorise If true, use packet operations where possible
+		/// \tparam Scalar The scalar type of the result
+		/// \param dst The output
+		/// \param start The first index to update
+		/// \param end One past the last index to update
+		/// \param carry The value to combine with
+		template<typename Reducer, bool Vectorise, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void applyScanCarry(Scalar *dst, size_t start, size_t end,
+												   Scalar carry) {
+			size_t index = start;
+
+			if constexpr (Vectorise) {
+				using Packet				 = typename typetraits::TypeInfo<Scalar>::Packet;
+				constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+				const Packet carryPacket(carry);
+				for (; index + packetWidth <= end; index += packetWidth) {
+					Reducer::combinePacket(carryPacket, Packet::load_unaligned(dst + index))
+					  .store_unaligned(dst + index);
+				}
+			}
+
+			for (; index < end; ++index) { dst[index] = Reducer::combine(carry, dst[index]); }
+		}
+
+		/// Compute the inclusive scan of the elements in the range [start, end) of an
+		/// array-like object. Large ranges are split into several chunks per thread (see
+		/// parallelPieces) and scanned in two passes: each chunk is scanned independently, then
+		/// every chunk is combined with the total of the chunks before it.
+		/// \see scanRange
+		template<typename Reducer, bool Vectorise, typename T, typename Scalar>
+		void scanRangeParallel(const T &val, Scalar *dst, size_t start, size_t end) {
+			const size_t elements = end - start;
+			if (elements > global::multithreadThreshold && global::numThreads > 1) {
+				constexpr size_t packetWidth = []() {
+					if constexpr (Vectorise) {
+						return typetraits::TypeInfo<Scalar>::packetWidth;
+					} else {
+						return 1;
+					}
+				}();
+
+				const int64_t pieces = parallelPieces(elements, packetWidth);
+
+				// Round chunks up to a whole number of packets so each chunk's packet loads
+				// remain aligned
+				const size_t chunk =
+				  ((elements + pieces - 1) / pieces + packetWidth - 1) / packetWidth * packetWidth;
+
+				std::vector<Scalar> totals(pieces, Reducer::template identity<Scalar>());
+
+				parallelFor(0, pieces, [&](int64_t piece) {
+					const size_t first = std::min(end, start + size_t(piece) * chunk);
+					const size_t last  = std::min(end, first + chunk);
+					totals[piece]	   = scanRange<Reducer, Vectorise>(
+						  val, dst, first, last, Reducer::template identity<Scalar>());
+				});
+
+				// The carry into each chunk is the exclusive scan of the chunk totals
+				std::vector<Scalar> carries(pieces);
+				Scalar running = Reducer::template identity<Scalar>();
+				for (int64_t piece = 0; piece < pieces; ++piece) {
+					carries[piece] = running;
+					running		   = Reducer::combine(running, totals[piece]);
+				}
+
+				parallelFor(1, pieces, [&](int64_t piece) {
+					const size_t first = std::min(end, start + size_t(piece) * chunk);
+					const size_t last  = std::min(end, first + chunk);
+					applyScanCarry<Reducer, Vectorise>(dst, first, last, carries[piece]);
+				});
+
+				return;
+			}
+
+			scanRange<Reducer, Vectorise>(
+			  val, dst, start, end, Reducer::template identity<Scalar>());
+		}
+
+		/// Scan a block of an array-like object viewed as a three-dimensional
+		/// [outer, scanned, inner] array along its middle dimension, where the inner dimension
+		/// is not empty. Each row of the scanned dimension is combined elementwise with the
+		/// (already scanned) row before it, so the contiguous inner dimension is processed with
+		/// packet operations.
+		/// \tparam Reducer The operation to scan with
+		/// \tparam Vectorise If true, use packet operations where possible
+		/// \param val The object to scan
+		/// \param dst The output (indexed in the same way as \p val)
+		/// \param outer Index into the outer dimension
+		/// \param length Extent of the scanned dimension
+		/// \param inner Extent of the inner dimension
+		/// \param innerBegin The first element of the inner dimension to process
+		/// \param innerEnd One past the last element of the inner dimension to process
+		template<typename Reducer, bool Vectorise, typename T, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void scanAxisBlock(const T &val, Scalar *dst, size_t outer,
+												  size_t length, size_t inner, size_t innerBegin,
+												  size_t innerEnd) {
+			for (size_t r = 0; r < length; ++r) {
+				const size_t base	 = (outer * length + r) * inner;
+				const Scalar *before = r == 0 ? nullptr : dst + base - inner;
+				size_t j			 = innerBegin;
+
+				auto scanScalar = [&](size_t k) {
+					const Scalar value = Scalar(val.scalar(base + k));
+					dst[base + k] = before == nullptr ? value : Reducer::combine(before[k], value);
+				};
+
+				if constexpr (Vectorise) {
+					using Packet				 = typename typetraits::TypeInfo<Scalar>::Packet;
+					constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					const size_t alignedBegin = std::min(
+					  innerEnd,
+					  (base + innerBegin + packetWidth - 1) / packetWidth * packetWidth - base);
+					const size_t vectorEnd =
+					  alignedBegin + (innerEnd - alignedBegin) / packetWidth * packetWidth;
+
+					for (; j < alignedBegin; ++j) { scanScalar(j); }
+
+					for (; j < vectorEnd; j += packetWidth) {
+						Packet value = val.packet(base + j);
+						if (before != nullptr) {
+							value =
+							  Reducer::combinePacket(Packet::load_unaligned(before + j), value);
+						}
+						value.store_unaligned(dst + base + j);
+					}
+				}
+
+				for (; j < innerEnd; ++j) { scanScalar(j); }
+			}
+		}
+
+		/// Compute the inclusive scan of an array-like object along a single axis
+		/// \tparam Reducer The operation to scan with
+		/// \tparam T The type of the object being scanned
+		/// \param val The object to scan
+		/// \param axis The axis to scan along (negative values count from the last dimension)
+		/// \return An array with the same shape as \p val, containing the result
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto scanAxis(const T &val, int64_t axis) {
+			using Type = std::decay_t<T>;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Scans are only supported for arrays on the CPU backend");
+
+			if constexpr (!ReductionTraits<Type>::direct) {
+				return scanAxis<Reducer>(val.eval(), axis);
+			} else {
+				using Scalar			 = typename ReductionTraits<Type>::Scalar;
+				constexpr bool vectorise = ReductionTraits<Type>::vectorise;
+				constexpr size_t packetWidth = []() {
+					if constexpr (vectorise) {
+						return typetraits::TypeInfo<Scalar>::packetWidth;
+					} else {
+						return 1;
+					}
+				}();
+
+				const auto shape   = val.shape();
+				const int64_t ndim = shape.ndim();
+				axis			   = normaliseReductionAxes({axis}, ndim)[0];
+
+				size_t outer = 1, length = 1, inner = 1;
+				std::vector<int64_t> resultShape;
+				for (int64_t i = 0; i < ndim; ++i) {
+					resultShape.push_back(shape[i]);
+					if (i < axis) {
+						outer *= shape[i];
+					} else if (i == axis) {
+						length = shape[i];
+					} else {
+						inner *= shape[i];
+					}
+				}
+
+				Array<Scalar, backend::CPU> result(Shape(resultShape));
+				Scalar *out = result.storage().begin();
+
+				const bool parallel =
+				  outer * length * inner > global::multithreadThreshold && global::numThreads > 1;
+
+				if (inner == 1) {
+					// Each row is contiguous. If there are enough rows to keep every thread busy,
+					// each thread scans whole rows. Otherwise, each row is scanned in parallel.
+					if (parallel && outer >= global::numThreads) {
+						parallelFor(0, static_cast<int64_t>(outer), [&](int64_t row) {
+							scanRange<Reducer, vectorise>(val,
+														  out,
+														  size_t(row) * length,
+														  size_t(row + 1) * length,
+														  Reducer::template identity<Scalar>());
+						});
+						return result;
+					}
+
+					for (size_t row = 0; row < outer; ++row) {
+						scanRangeParallel<Reducer, vectorise>(
+						  val, out, row * length, (row + 1) * length);
+					}
+					return result;
+				}
+
+				// Process the inner dimension in blocks small enough for the previous row of the
+				// output to stay in the L1 cache
+				const size_t blockSize =
+				  std::max(packetWidth, size_t(16384 / sizeof(Scalar)) / packetWidth * packetWidth);
+				const size_t innerBlocks = (inner + blockSize - 1) / blockSize;
+				const int64_t tasks		 = static_cast<int64_t>(outer * innerBlocks);
+
+				auto runTask = [&](int64_t task) {
+					const size_t o			= size_t(task) / innerBlocks;
+					const size_t innerBegin = (size_t(task) % innerBlocks) * blockSize;
+					const size_t innerEnd	= std::min(inner, innerBegin + blockSize);
+					scanAxisBlock<Reducer, vectorise>(
+					  val, out, o, length, inner, innerBegin, innerEnd);
+				};
+
+				if (parallel) {
+					parallelFor(0, tasks, runTask);
+					return result;
+				}
+
+				for (int64_t task = 0; task < tasks; ++task) { runTask(task); }
+				return result;
+			}
+		}
+
+		/// Compute the inclusive scan of every element of an array-like object, in row-major
+		/// order
+		/// \tparam Reducer The operation to scan with
+		/// \tparam T The type of the object being scanned
+		/// \param val The object to scan
+		/// \return A one-dimensional array containing the result
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto scanAll(const T &val) {
+			using Type = std::decay_t<T>;
+			static_assert(
+			  std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+			  "Scans are only supported for arrays on the CPU backend");
+
+			if constexpr (!ReductionTraits<Type>::direct) {
+				return scanAll<Reducer>(val.eval());
+			} else {
+				using Scalar	  = typename ReductionTraits<Type>::Scalar;
+				const size_t size = val.shape().size();
+
+				Array<Scalar, backend::CPU> result(Shape({static_cast<int64_t>(size)}));
+				scanRangeParallel<Reducer, ReductionTraits<Type>::vectorise>(
+				  val, result.storage().begin(), 0, size);
+				return result;
+			}
+		}
+	} // namespace detail
+
+	/// \brief Compute the cumulative sum of the elements of an array
+	///
+	/// The array is flattened (in row-major order) first, so the result is one-dimensional.
+	/// Array expressions are scanned directly, without being evaluated into a temporary array.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to scan
+	/// \return \f$ R_i = \sum_{j \le i} x_j \f$
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cumsum(const T &val) {
+		return detail::scanAll<detail::reduction::Sum>(val);
+	}
+
+	/// \brief Compute the cumulative sum of the elements of an array along an axis
+	///
+	/// Negative axes count from the last dimension. The result has the same shape as the input.
+	/// \tparam T The type of the input
+	/// \param val The array or array expression to scan
+	/// \param axis The axis to scan along
+	/// \return An array containing the cumulative sums
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cumsum(const T &val, int64_t axis) {
+		return detail::scanAxis<detail::reduction::Sum>(val, axis);
+	}
+
+	/// \brief Compute the cumulative product of the elements of an array
+	/// \see cumsum(const T &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cumprod(const T &val) {
+		return detail::scanAll<detail::reduction::Prod>(val);
+	}
+
+	/// \brief Compute the cumulative product of the elements of an array along an axis
+	/// \see cumsum(const T &, int64_t)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cumprod(const T &val, int64_t axis) {
+		return detail::scanAxis<detail::reduction::Prod>(val, axis);
+	}
+
+	/// \brief Compute the running minimum of the elements of an array
+	/// \see cumsum(const T &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cummin(const T &val) {
+		return detail::scanAll<detail::reduction::Min>(val);
+	}
+
+	/// \brief Compute the running minimum of the elements of an array along an axis
+	/// \see cumsum(const T &, int64_t)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cummin(const T &val, int64_t axis) {
+		return detail::scanAxis<detail::reduction::Min>(val, axis);
+	}
+
+	/// \brief Compute the running maximum of the elements of an array
+	/// \see cumsum(const T &)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cummax(const T &val) {
+		return detail::scanAll<detail::reduction::Max>(val);
+	}
+
+	/// \brief Compute the running maximum of the elements of an array along an axis
+	/// \see cumsum(const T &, int64_t)
+	template<typename T>
+		requires(IsArrayType<std::decay_t<T>>::value)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto cummax(const T &val, int64_t axis) {
+		return detail::scanAxis<detail::reduction::Max>(val, axis);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SCANS_HPP
@@ -25,6 +25,55 @@ namespace librapid {
 		LIBRAPID_DEFINE_AS_TYPE(typename Scalar, Storage<Scalar>);
 	} // namespace typetraits
 
+	namespace detail {
+		/// Space for \p N elements of type \p T inside an object, aligned for packet access. The
+		/// elements are not constructed, so this is only suitable for trivial types.
+		/// \tparam T The element type
+		/// \tparam N The number of elements
+		template<typename T, size_t N>
+		struct InlineBuffer {
+			alignas(LIBRAPID_MEM_ALIGN) unsigned char bytes[N * sizeof(T)];
+
+			LIBRAPID_ALWAYS_INLINE T *data() noexcept { return reinterpret_cast<T *>(bytes); }
+
+			LIBRAPID_ALWAYS_INLINE const T *data() const noexcept {
+				return reinterpret_cast<const T *>(bytes);
+			}
+		};
+
+		template<typename T>
+		struct InlineBuffer<T, 0> {
+			LIBRAPID_ALWAYS_INLINE T *data() noexcept { return nullptr; }
+			LIBRAPID_ALWAYS_INLINE const T *data() const noexcept { return nullptr; }
+		};
+
+		/// The number of elements of type \p T a Storage object can hold without allocating
+		/// memory (see LIBRAPID_STORAGE_INLINE_BYTES)
+		template<typename T>
+		constexpr size_t storageInlineCapacity() {
+			if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T> &&
+						  typetraits::TriviallyDefaultConstructible<T>::value &&
+						  alignof(T) <= LIBRAPID_MEM_ALIGN) {
+				return LIBRAPID_STORAGE_INLINE_BYTES / sizeof(T);
+			} else {
+				return 0;
+			}
+		}
+
+		/// Reference counts for a block of memory shared by several Storage objects. Owners have
+		/// value semantics, so the block is copied before one of them modifies it, while views
+		/// write to the block directly. Both keep the block alive.
+		/// \tparam T The element type
+		template<typename T>
+		struct StorageControl {
+			T *begin		= nullptr; // The start of the block
+			size_t capacity = 0;	   // The number of elements in the block
+
+			std::atomic<size_t> owners {1};		// Owning Storage objects
+			std::atomic<size_t> references {1}; // Owners and views
+		};
+	} // namespace detail
+
 	template<typename Scalar_>
 	class Storage {
 	public:
@@ -42,6 +91,10 @@ namespace librapid {
 		using ReverseIterator				  = std::reverse_iterator<Iterator>;
 		using ConstReverseIterator			  = std::reverse_iterator<ConstIterator>;
 
+		/// The number of elements which are stored inside the object itself, rather than in
+		/// allocated memory
+		static constexpr SizeType inlineCapacity = detail::storageInlineCapacity<Scalar>();
+
 		/// Default constructor
 		Storage() = default;
 
@@ -57,9 +110,10 @@ namespace librapid {
 		/// \param value Value to initialize each element to
 		LIBRAPID_ALWAYS_INLINE Storage(SizeType size, ConstReference value);
 
-		/// Create a Storage object from another Storage object. Additionally
-		/// a custom allocator can be used. The data is **NOT** copied -- it is referenced
-		/// by the new Storage object. For a deep copy, use the ``copy()`` method.
+		/// Create a Storage object from another Storage object. The data is **NOT** copied --
+		/// it is shared by both objects until one of them is modified, at which point that
+		/// object makes a copy of its own (copy-on-write). For an immediate deep copy, use the
+		/// ``copy()`` method.
 		/// \param other Storage object to copy
 		LIBRAPID_ALWAYS_INLINE Storage(const Storage &other);
 
@@ -91,7 +145,9 @@ namespace librapid {
 		/// \return *this
 		LIBRAPID_ALWAYS_INLINE Storage &operator=(const Storage &other);
 
-		/// Move assignment operator for a Storage object
+		/// Move assignment operator for a Storage object. This object releases its own elements
+		/// and takes over those of \p other, without copying them, so if \p other is a view
+		/// (see view()), this object becomes a view of the same elements.
 		/// \param other Storage object to move
 		/// \return *this
 		LIBRAPID_ALWAYS_INLINE Storage &operator=(Storage &&other) noexcept;
@@ -116,33 +172,85 @@ namespace librapid {
 		static ShapeType defaultShape();
 
 		/// Resize a Storage object to \p size elements. Existing elements
-		/// are preserved.
+		/// are preserved. If the new size fits within the capacity, no memory is allocated.
 		/// \param size New size of the Storage object
 		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize);
 
 		/// Resize a Storage object to \p size elements. Existing elements
-		/// are not preserved
+		/// are not preserved. The existing memory is reused if it is large enough, unless more
+		/// than half of it would be unused.
 		/// \param size New size of the Storage object
 		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize, int);
 
+		/// Resize a Storage object to \p size elements which are all about to be overwritten.
+		/// Unlike resize(newSize, 0), elements shared with a copy of this object are never
+		/// copied, so this must only be used when the new values do not depend on the old ones.
+		/// \param size New size of the Storage object
+		LIBRAPID_ALWAYS_INLINE void resizeForOverwrite(SizeType newSize);
+
+		/// Ensure the Storage object can hold at least \p newCapacity elements without
+		/// allocating more memory. Existing elements are preserved.
+		/// \param newCapacity The number of elements to reserve space for
+		LIBRAPID_ALWAYS_INLINE void reserve(SizeType newCapacity);
+
+		/// Release any memory beyond the size of the Storage object. Existing elements are
+		/// preserved.
+		LIBRAPID_ALWAYS_INLINE void shrinkToFit();
+
+		/// \brief Return a Storage object referencing \p size elements of this one, starting at
+		/// \p offset
+		///
+		/// The view and this object alias the same elements, so writes through either one are
+		/// seen by the other. Before the view is created, this object is given elements of its
+		/// own if they were shared with a copy (and inline elements are moved to the heap), so
+		/// copies of this object never see writes through the view. While the view exists,
+		/// copying this object or the view copies the elements rather than sharing them, and
+		/// copy-assigning a Storage object of the same size to this object writes into the
+		/// viewed elements.
+		///
+		/// The view keeps the elements alive, so it remains valid after this object is
+		/// destroyed, moved from or reallocated, but from then on it no longer aliases this
+		/// object. A view cannot be resized, and moving it into another Storage object makes
+		/// that object the view.
+		/// \param offset The index of the first element of the view
+		/// \param size The number of elements in the view
+		/// \return The view
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Storage view(SizeType offset, SizeType size);
+
+		/// Returns true if the elements are shared with a copy of this object, in which case
+		/// they will be copied before they are next modified
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isShared() const noexcept;
+
 		/// Return the number of elements in the Storage object
 		/// \return
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType size() const noexcept;
 
+		/// Return the number of elements the Storage object can hold without allocating more
+		/// memory
+		/// \return The capacity of the Storage object
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType capacity() const noexcept;
+
 		/// Const access to the element at index \p index
 		/// \param index Index of the element to access
 		/// \return Const reference to the element at index \p index
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReference operator[](SizeType index) const;
 
-		/// Access to the element at index \p index
+		/// Access to the element at index \p index. If the elements are shared with a copy
+		/// of this object, they are copied first.
 		/// \param index Index of the element to access
 		/// \return Reference to the element at index \p index
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Reference operator[](SizeType index);
 
+		/// Return a pointer to the elements, without copying them if they are shared. Only use
+		/// this for reading.
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer data() const noexcept;
 
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer begin() noexcept;
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer end() noexcept;
+		/// Return a pointer to the elements, copying them first if they are shared with a copy
+		/// of this object. The same applies to the other non-const iterator accessors.
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer data();
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer begin();
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer end();
 
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstPointer begin() const noexcept;
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstPointer end() const noexcept;
@@ -150,8 +258,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cbegin() const noexcept;
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cend() const noexcept;
 
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rbegin() noexcept;
-		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rend() noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rbegin();
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rend();
 
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator rbegin() const noexcept;
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator rend() const noexcept;
@@ -160,6 +268,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator crend() const noexcept;
 
 	private:
+		using Control = detail::StorageControl<Scalar>;
+
 		/// Copy data from \p begin to \p end into this Storage object
 		/// \tparam P Pointer type
 		/// \param begin Beginning of data to copy
@@ -170,14 +280,70 @@ namespace librapid {
 		template<typename P>
 		LIBRAPID_ALWAYS_INLINE void initData(P begin, SizeType size);
 
+		/// Move the data into a block of \p newCapacity elements, keeping as many of the
+		/// existing elements as fit. The size is not changed.
+		/// \param newCapacity The capacity of the new block
+		LIBRAPID_ALWAYS_INLINE void reallocate(SizeType newCapacity);
+
+		/// Point this object at memory for \p capacity elements -- the inline buffer if it is
+		/// large enough, and a newly allocated block otherwise. Any existing memory must already
+		/// have been released.
+		/// \param capacity The number of elements required
+		LIBRAPID_ALWAYS_INLINE void allocate(SizeType capacity);
+
+		/// Free the memory owned by this object, if any, or drop this object's reference to a
+		/// shared block. The pointer, size and capacity are not changed.
+		LIBRAPID_ALWAYS_INLINE void release();
+
+		/// Give this object a copy of the elements if they are shared with another owner. This
+		/// must be called before the elements are modified.
+		LIBRAPID_ALWAYS_INLINE void detach();
+
+		/// The slow path of detach()
+		void detachShared();
+
+		/// Delete the control block if nothing else references this object's memory any more
+		/// \return True if there is no longer a control block
+		LIBRAPID_ALWAYS_INLINE bool dropUnusedControl();
+
+		/// Return the control block for this object's memory, creating it if necessary. This
+		/// is safe to call from several threads at once.
+		LIBRAPID_NODISCARD Control *control() const;
+
+		/// Returns true if copies of this object can share its elements. This is not the case
+		/// for views, inline elements, or elements which are referenced by a view (since the
+		/// view could modify them).
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool canShare() const;
+
+		/// Share the elements of \p other, which must satisfy canShare(). Any existing memory
+		/// must already have been released.
+		/// \param other The Storage object to share the elements of
+		LIBRAPID_ALWAYS_INLINE void shareFrom(const Storage &other);
+
+		/// Returns true if the elements are stored in the inline buffer
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isInline() const noexcept;
+
+		/// Take the data from \p other, leaving it empty. Any existing memory must already have
+		/// been released.
+		/// \param other The Storage object to take the data from
+		LIBRAPID_ALWAYS_INLINE void takeFrom(Storage &other) noexcept;
+
 #if defined(LIBRAPID_NATIVE_ARCH)
 		alignas(LIBRAPID_MEM_ALIGN) Pointer m_begin = nullptr;
 #else
 		Pointer m_begin = nullptr; // Pointer to the beginning of the data
 #endif
 
-		SizeType m_size = 0;	// Number of elements in the Storage object
-		bool m_ownsData = true; // Whether this Storage object owns the data it points to
+		SizeType m_size		= 0;	// Number of elements in the Storage object
+		SizeType m_capacity = 0;	// Number of elements allocated
+		bool m_ownsData		= true; // Whether this Storage object owns the data it points to
+
+		// Reference counts, if the memory has ever been shared. This is created lazily, so
+		// Storage objects which are never copied do not pay for it.
+		mutable Control *m_control = nullptr;
+
+		// Space for small arrays, so they do not need to allocate memory
+		LIBRAPID_NO_UNIQUE_ADDRESS detail::InlineBuffer<Scalar, inlineCapacity> m_inline;
 	};
 
 	template<typename Scalar_, size_t... Size_>
@@ -328,21 +494,14 @@ namespace librapid {
 				for (size_t i = 0; i < size; ++i) { ptr_[i].~T(); }
 			}
 
-#if defined(LIBRAPID_BLAS_MKLBLAS)
-			mkl_free(ptr_);
-#elif defined(LIBRAPID_APPLE)
-			free(ptr_);
-#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
-			_aligned_free(ptr_);
-#else
-			free(ptr_);
-#endif
+			deallocateBytes(ptr_, size * sizeof(T));
 		}
 
 		/// Safely allocate memory for \p size elements using the allocator \p alloc. If the data
 		/// can be trivially default constructed, then the constructor is not called and no data
 		/// is initialized. Otherwise, the correct default constructor will be called for each
-		/// element in the data, making sure the returned pointer is safe to use.
+		/// element in the data, making sure the returned pointer is safe to use. The memory
+		/// comes from allocateBytes, so freed blocks are reused where possible.
 		/// \tparam A The allocator type to use
 		/// \param alloc The allocator object to use
 		/// \param size Number of elements to allocate
@@ -353,30 +512,7 @@ namespace librapid {
 			if (size == 0) return nullptr;
 
 			using Pointer = T *;
-
-#if defined(LIBRAPID_BLAS_MKLBLAS)
-			// MKL has its own memory allocation function
-			auto ptr = static_cast<Pointer>(mkl_malloc(size * sizeof(T), 64));
-#elif defined(LIBRAPID_APPLE)
-			// Use posix_memalign
-			void *_ptr;
-			auto err = posix_memalign(&_ptr, LIBRAPID_MEM_ALIGN, size * sizeof(T));
-			LIBRAPID_ASSERT(err == 0, "posix_memalign failed with error code {}", err);
-			auto ptr = static_cast<Pointer>(_ptr);
-#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
-			Pointer ptr;
-			try {
-				ptr = static_cast<Pointer>(_aligned_malloc(size * sizeof(T), LIBRAPID_MEM_ALIGN));
-			} catch (const std::exception &) {
-				LIBRAPID_ASSERT(false, "Failed to allocate {} bytes of memory", size * sizeof(T));
-			}
-#else
-			auto ptr =
-			  static_cast<Pointer>(std::aligned_alloc(LIBRAPID_MEM_ALIGN, size * sizeof(T)));
-#endif
-
-			LIBRAPID_ASSERT(
-			  ptr != nullptr, "Failed to allocate {} bytes of memory", size * sizeof(T));
+			auto ptr	  = static_cast<Pointer>(allocateBytes(size * sizeof(T)));
 
 			// If the type cannot be trivially constructed, we need to
 			// initialize each value
@@ -416,18 +552,18 @@ namespace librapid {
 	} // namespace detail
 
 	template<typename T>
-	Storage<T>::Storage(SizeType size) :
-			m_begin(detail::safeAllocate<T>(size)), m_size(size), m_ownsData(true) {
+	Storage<T>::Storage(SizeType size) : m_size(size), m_ownsData(true) {
+		allocate(size);
 	}
 
 	template<typename T>
 	Storage<T>::Storage(Scalar *begin, Scalar *end, bool ownsData) :
-			m_begin(begin), m_size(std::distance(begin, end)), m_ownsData(ownsData) {
-	}
+			m_begin(begin), m_size(std::distance(begin, end)), m_capacity(m_size),
+			m_ownsData(ownsData) {}
 
 	template<typename T>
-	Storage<T>::Storage(SizeType size, ConstReference value) :
-			m_begin(detail::safeAllocate<T>(size)), m_size(size), m_ownsData(true) {
+	Storage<T>::Storage(SizeType size, ConstReference value) : m_size(size), m_ownsData(true) {
+		allocate(size);
 		auto ptr_ = LIBRAPID_ASSUME_ALIGNED(m_begin);
 		for (SizeType i = 0; i < size; ++i) { ptr_[i] = value; }
 	}
@@ -436,17 +572,17 @@ namespace librapid {
 	Storage<T>::Storage(const Storage &other) : m_size(other.m_size), m_ownsData(true) {
 		if (m_size == 0) return; // Quick return
 
-		// Copy the data from `other`
-		initData(other.begin(), other.end());
+		// Share the data with `other` where possible, otherwise copy it
+		if (other.canShare()) {
+			shareFrom(other);
+		} else {
+			initData(other.begin(), other.end());
+		}
 	}
 
 	template<typename T>
-	Storage<T>::Storage(Storage &&other) noexcept :
-			m_begin(std::move(other.m_begin)), m_size(std::move(other.m_size)),
-			m_ownsData(std::move(other.m_ownsData)) {
-		other.m_begin	 = nullptr;
-		other.m_size	 = 0;
-		other.m_ownsData = false;
+	Storage<T>::Storage(Storage &&other) noexcept {
+		takeFrom(other);
 	}
 
 	template<typename T>
@@ -480,13 +616,24 @@ namespace librapid {
 		if (this != &other) {
 			if (other.m_size == 0) return *this; // Quick return
 
-			size_t oldSize = m_size;
-			m_size		   = other.m_size;
-			if (oldSize != m_size) LIBRAPID_UNLIKELY {
+			// Share the data with `other` where possible. This is not done if a view references
+			// the existing data, since the view should see the new values.
+			bool viewed = false;
+			if (m_control != nullptr) {
+				const size_t owners = m_control->owners.load(std::memory_order_acquire);
+				viewed = m_control->references.load(std::memory_order_acquire) > owners;
+			}
+
+			if (m_ownsData && !viewed && other.canShare()) {
+				release();
+				shareFrom(other);
+				return *this;
+			}
+
+			if (m_size != other.m_size) LIBRAPID_UNLIKELY {
 					if (m_ownsData) LIBRAPID_LIKELY {
-							// Reallocate
-							detail::safeDeallocate(m_begin, oldSize);
-							m_begin = detail::safeAllocate<Scalar>(m_size);
+							// Reallocate (if the existing memory cannot be reused)
+							resize(other.m_size, 0);
 						}
 					else
 						LIBRAPID_UNLIKELY {
@@ -495,7 +642,7 @@ namespace librapid {
 						}
 				}
 
-			detail::fastCopy(m_begin, other.m_begin, m_size);
+			detail::fastCopy(begin(), other.m_begin, m_size);
 		}
 		return *this;
 	}
@@ -503,20 +650,15 @@ namespace librapid {
 	template<typename T>
 	auto Storage<T>::operator=(Storage &&other) noexcept -> Storage & {
 		if (this != &other) {
-			m_begin	   = std::move(other.m_begin);
-			m_size	   = std::move(other.m_size);
-			m_ownsData = std::move(other.m_ownsData);
-
-			other.m_begin	 = nullptr;
-			other.m_size	 = 0;
-			other.m_ownsData = false;
+			release();
+			takeFrom(other);
 		}
 		return *this;
 	}
 
 	template<typename T>
 	Storage<T>::~Storage() {
-		if (m_ownsData) { detail::safeDeallocate(m_begin, m_size); }
+		release();
 	}
 
 	template<typename T>
@@ -525,12 +667,13 @@ namespace librapid {
 		// Quick return in the case of empty range
 		if (begin == nullptr || end == nullptr || begin == end) return;
 
-		m_size			= static_cast<SizeType>(std::distance(begin, end));
-		m_begin			= detail::safeAllocate<T>(m_size);
-		m_ownsData		= true;
-		auto thisBegin	= LIBRAPID_ASSUME_ALIGNED(m_begin);
-		auto otherBegin = LIBRAPID_ASSUME_ALIGNED(begin);
-		detail::fastCopy(thisBegin, otherBegin, m_size);
+		m_size	   = static_cast<SizeType>(std::distance(begin, end));
+		m_ownsData = true;
+		allocate(m_size);
+
+		// The source may be a view, so is not necessarily aligned
+		auto thisBegin = LIBRAPID_ASSUME_ALIGNED(m_begin);
+		detail::fastCopy(thisBegin, begin, m_size);
 	}
 
 	template<typename T>
@@ -568,26 +711,220 @@ namespace librapid {
 	}
 
 	template<typename T>
-	void Storage<T>::resize(SizeType newSize) {
-		// Resize and retain data
-		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
-		if (newSize == size()) return;
+	auto Storage<T>::capacity() const noexcept -> SizeType {
+		return m_capacity;
+	}
+
+	template<typename T>
+	auto Storage<T>::view(SizeType offset, SizeType size) -> Storage {
+		LIBRAPID_ASSERT(offset + size <= m_size,
+						"View of {} elements at offset {} is out of bounds for size {}",
+						size,
+						offset,
+						m_size);
+
+		// Writes through the view must not be seen by copies of this object
+		detach();
+
+		// The inline buffer moves with this object, so it cannot be referenced by a view
+		if (isInline()) {
+			Pointer block = detail::safeAllocate<T>(m_capacity);
+			detail::fastCopy(block, m_begin, m_size);
+			m_begin = block;
+		}
+
+		Storage res(m_begin + offset, m_begin + offset + size, false);
+		if (m_ownsData || m_control != nullptr) {
+			res.m_control = control();
+			res.m_control->references.fetch_add(1, std::memory_order_relaxed);
+		}
+		return res;
+	}
+
+	template<typename T>
+	auto Storage<T>::isShared() const noexcept -> bool {
+		return m_ownsData && m_control != nullptr &&
+			   m_control->owners.load(std::memory_order_acquire) > 1;
+	}
+
+	template<typename T>
+	auto Storage<T>::isInline() const noexcept -> bool {
+		if constexpr (inlineCapacity > 0) {
+			return m_begin == m_inline.data();
+		} else {
+			return false;
+		}
+	}
 
+	template<typename T>
+	void Storage<T>::allocate(SizeType capacity) {
+		if (capacity > 0 && capacity <= inlineCapacity) {
+			m_begin	   = m_inline.data();
+			m_capacity = inlineCapacity;
+		} else {
+			m_begin	   = detail::safeAllocate<T>(capacity);
+			m_capacity = capacity;
+		}
+	}
+
+	template<typename T>
+	void Storage<T>::release() {
+		if (m_control != nullptr) {
+			// The block is freed by whichever object releases it last
+			if (m_ownsData) m_control->owners.fetch_sub(1, std::memory_order_release);
+			if (m_control->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				detail::safeDeallocate(m_control->begin, m_control->capacity);
+				delete m_control;
+			}
+			m_control = nullptr;
+		} else if (m_ownsData && !isInline()) {
+			detail::safeDeallocate(m_begin, m_capacity);
+		}
+	}
+
+	template<typename T>
+	void Storage<T>::detach() {
+		// A view of the elements keeps the control block alive, but only requires a copy (or
+		// allows the control block to be dropped) once the view is the last other reference
+		if (m_control != nullptr) LIBRAPID_UNLIKELY {
+				if (m_ownsData &&
+					(m_control->owners.load(std::memory_order_acquire) > 1 ||
+					 m_control->references.load(std::memory_order_acquire) == 1)) {
+					detachShared();
+				}
+			}
+	}
+
+	template<typename T>
+	void Storage<T>::detachShared() {
+		if (!m_ownsData) return; // Views always write to the shared block
+		if (dropUnusedControl()) return;
+		if (m_control->owners.load(std::memory_order_acquire) > 1) *this = copy();
+	}
+
+	template<typename T>
+	auto Storage<T>::dropUnusedControl() -> bool {
+		if (m_control == nullptr) return true;
+		if (!m_ownsData || m_control->references.load(std::memory_order_acquire) > 1) {
+			return false;
+		}
+
+		delete m_control;
+		m_control = nullptr;
+		return true;
+	}
+
+	template<typename T>
+	auto Storage<T>::control() const -> Control * {
+		std::atomic_ref<Control *> ref(m_control);
+		Control *existing = ref.load(std::memory_order_acquire);
+		if (existing != nullptr) return existing;
+
+		// Another thread may be copying this object at the same time, so only one of the new
+		// control blocks is kept
+		auto *created	  = new Control();
+		created->begin	  = m_begin;
+		created->capacity = m_capacity;
+		if (ref.compare_exchange_strong(existing, created, std::memory_order_acq_rel)) {
+			return created;
+		}
+
+		delete created;
+		return existing;
+	}
+
+	template<typename T>
+	auto Storage<T>::canShare() const -> bool {
+		if (!m_ownsData || m_begin == nullptr || isInline()) return false;
+
+		Control *existing = std::atomic_ref<Control *>(m_control).load(std::memory_order_acquire);
+		return existing == nullptr || existing->references.load(std::memory_order_acquire) ==
+										existing->owners.load(std::memory_order_acquire);
+	}
+
+	template<typename T>
+	void Storage<T>::shareFrom(const Storage &other) {
+		m_control = other.control();
+		m_control->owners.fetch_add(1, std::memory_order_relaxed);
+		m_control->references.fetch_add(1, std::memory_order_relaxed);
+
+		m_begin	   = other.m_begin;
+		m_size	   = other.m_size;
+		m_capacity = other.m_capacity;
+		m_ownsData = true;
+	}
+
+	template<typename T>
+	void Storage<T>::takeFrom(Storage &other) noexcept {
+		m_begin = other.m_begin;
+		if constexpr (inlineCapacity > 0) {
+			if (other.isInline()) {
+				// The elements are trivially copyable, so can simply be copied across
+				m_begin = m_inline.data();
+				std::memcpy(m_begin, other.m_begin, other.m_size * sizeof(T));
+			}
+		}
+
+		m_size	   = other.m_size;
+		m_capacity = other.m_capacity;
+		m_ownsData = other.m_ownsData;
+		m_control  = other.m_control;
+
+		other.m_begin	 = nullptr;
+		other.m_size	 = 0;
+		other.m_capacity = 0;
+		other.m_ownsData = true; // An empty Storage object, which can be reused
+		other.m_control	 = nullptr;
+	}
+
+	template<typename T>
+	void Storage<T>::reallocate(SizeType newCapacity) {
 		LIBRAPID_ASSERT(m_ownsData, "Dependent storage cannot be resized");
 
-		// Copy the existing data to a new location
-		Pointer oldBegin = LIBRAPID_ASSUME_ALIGNED(m_begin);
-		SizeType oldSize = m_size;
+		// The inline buffer is already as small as it can be
+		if (isInline() && newCapacity <= inlineCapacity) return;
+
+		// Huge page mappings can be resized (or moved) by the operating system without
+		// copying any data, but this is only valid for types which can be copied bytewise
+		if constexpr (std::is_trivially_copyable_v<T> &&
+					  typetraits::TriviallyDefaultConstructible<T>::value) {
+			if (m_begin != nullptr && newCapacity > inlineCapacity && !isInline() &&
+				dropUnusedControl()) {
+				void *moved = detail::reallocateBytes(
+				  m_begin, m_capacity * sizeof(T), newCapacity * sizeof(T));
+				if (moved != nullptr) {
+					m_begin	   = static_cast<Pointer>(moved);
+					m_capacity = newCapacity;
+					return;
+				}
+			}
+		}
+
+		// Move the old block into a temporary object, which frees it (or releases this
+		// object's reference to it, if it is shared) once the data has been copied
+		Storage old;
+		old.takeFrom(*this);
+		m_size	   = old.m_size;
+		m_ownsData = true;
 
-		// Allocate a new block of memory
-		m_begin = LIBRAPID_ASSUME_ALIGNED(detail::safeAllocate<T>(newSize));
-		m_size	= newSize;
+		// Allocate a new block of memory (or move into the inline buffer)
+		allocate(newCapacity);
 
 		// Copy the data
-		detail::fastCopy(m_begin, oldBegin, std::min(oldSize, newSize));
+		detail::fastCopy(m_begin, old.m_begin, std::min(m_size, newCapacity));
+	}
+
+	template<typename T>
+	void Storage<T>::resize(SizeType newSize) {
+		// Resize and retain data
+		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
+		if (newSize == size()) return;
+
+		LIBRAPID_ASSERT(m_ownsData, "Dependent storage cannot be resized");
 
-		// Free the old block of memory
-		detail::safeDeallocate(oldBegin, oldSize);
+		// Grow or shrink in place if the existing memory is large enough
+		if (newSize > m_capacity) reallocate(newSize);
+		m_size = newSize;
 	}
 
 	template<typename T>
@@ -596,18 +933,54 @@ namespace librapid {
 
 		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
 
-		if (size() == newSize) return;
+		// The elements are about to be overwritten, so make sure they are not shared. They
+		// are still copied if the size is unchanged, since the new values may depend on them
+		// (as in `a = a + b`).
+		if (size() == newSize) {
+			detach();
+			return;
+		}
+
+		resizeForOverwrite(newSize);
+	}
+
+	template<typename T>
+	void Storage<T>::resizeForOverwrite(SizeType newSize) {
+		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
+
+		if (size() == newSize && !isShared()) {
+			detach();
+			return;
+		}
 		LIBRAPID_ASSERT(m_ownsData, "Dependent storage cannot be resized");
 
-		Pointer oldBegin = LIBRAPID_ASSUME_ALIGNED(m_begin);
-		SizeType oldSize = m_size;
+		// Reuse the existing memory if it is large enough, unless most of it would be wasted
+		// (the inline buffer is never wasted) or it is shared
+		if (newSize > m_capacity || (newSize < m_capacity / 2 && !isInline()) || isShared()) {
+			// Free the old block first, so the allocator can hand it straight back if it is
+			// a similar size
+			release();
+			m_begin	   = nullptr;
+			m_size	   = 0;
+			m_capacity = 0;
+
+			allocate(newSize);
+		}
+
+		m_size = newSize;
+	}
 
-		// Allocate a new block of memory
-		m_begin = detail::safeAllocate<T>(newSize);
-		m_size	= newSize;
+	template<typename T>
+	void Storage<T>::reserve(SizeType newCapacity) {
+		if (newCapacity <= m_capacity) return;
+		reallocate(newCapacity);
+	}
 
-		// Free the old block of memory
-		detail::safeDeallocate(oldBegin, oldSize);
+	template<typename T>
+	void Storage<T>::shrinkToFit() {
+		// Memory which is shared would not be freed, so leave it alone
+		if (m_capacity == m_size || !m_ownsData || isInline() || !dropUnusedControl()) return;
+		reallocate(m_size);
 	}
 
 	template<typename T>
@@ -619,6 +992,7 @@ namespace librapid {
 	template<typename T>
 	auto Storage<T>::operator[](Storage<T>::SizeType index) -> Reference {
 		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		detach();
 		return m_begin[index];
 	}
 
@@ -628,12 +1002,20 @@ namespace librapid {
 	}
 
 	template<typename T>
-	auto Storage<T>::begin() noexcept -> Pointer {
+	auto Storage<T>::data() -> Pointer {
+		detach();
+		return m_begin;
+	}
+
+	template<typename T>
+	auto Storage<T>::begin() -> Pointer {
+		detach();
 		return m_begin;
 	}
 
 	template<typename T>
-	auto Storage<T>::end() noexcept -> Pointer {
+	auto Storage<T>::end() -> Pointer {
+		detach();
 		return m_begin + m_size;
 	}
 
@@ -658,12 +1040,14 @@ namespace librapid {
 	}
 
 	template<typename T>
-	auto Storage<T>::rbegin() noexcept -> ReverseIterator {
+	auto Storage<T>::rbegin() -> ReverseIterator {
+		detach();
 		return ReverseIterator(m_begin + m_size);
 	}
 
 	template<typename T>
-	auto Storage<T>::rend() noexcept -> ReverseIterator {
+	auto Storage<T>::rend() -> ReverseIterator {
+		detach();
 		return ReverseIterator(m_begin);
 	}
 
@@ -283,6 +283,18 @@
 #	endif
 #endif // Instruction set detection
 
+// Fused multiply-add instructions. MSVC does not define __FMA__, but every AVX2 target has them
+#if defined(__FMA__) || defined(__AVX512F__) || (defined(_MSC_VER) && defined(__AVX2__)) ||      \
+  defined(__aarch64__) || defined(_M_ARM64)
+#	define LIBRAPID_HAS_FMA
+#endif
+
+// Storage objects keep up to this many bytes of (trivially copyable) elements inside the object
+// itself, so very small arrays never allocate memory. Define it as 0 to always allocate.
+#ifndef LIBRAPID_STORAGE_INLINE_BYTES
+#	define LIBRAPID_STORAGE_INLINE_BYTES 128
+#endif
+
 // Check for 32bit vs 64bit
 #if _WIN32 || _WIN64 // Check windows
 #	if _WIN64
@@ -365,6 +377,13 @@
 // [[nodiscard]] macro
 #define LIBRAPID_NODISCARD [[nodiscard]]
 
+// [[no_unique_address]] macro (MSVC ignores the standard attribute)
+#if defined(LIBRAPID_MSVC)
+#	define LIBRAPID_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#	define LIBRAPID_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 // Nicer FILENAME macro
 #if defined(FILENAME)
 #	warning                                                                                        \
@@ -6,6 +6,7 @@
 #include "debugTrap.hpp"
 #include "config.hpp"
 #include "global.hpp"
+#include "threadPool.hpp"
 #include "traits.hpp"
 #include "typetraits.hpp"
 #include "helperMacros.hpp"
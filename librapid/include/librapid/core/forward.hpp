@@ -26,7 +26,10 @@ namespace librapid {
 	namespace array {
 		template<typename ShapeType_, typename StorageType_>
 		class ArrayContainer;
-	}
+
+		template<typename T, typename ShapeType_>
+		class GeneralArrayView;
+	} // namespace array
 
 	namespace typetraits {
 		/// Evaluates as true if the input type is an ArrayContainer instance
@@ -81,6 +84,18 @@ namespace librapid {
 		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
 		  const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
 
+		template<typename T>
+		LIBRAPID_NODISCARD auto parallelThreshold(const T &val) -> size_t;
+
+		template<typename T>
+		LIBRAPID_NODISCARD bool readsFrom(const T &val, const void *array);
+
+		template<typename ShapeType_, typename StorageScalar, typename ArrayViewType,
+				 typename ArrayViewShapeType>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar>> &lhs,
+			   const array::GeneralArrayView<ArrayViewType, ArrayViewShapeType> &view);
+
 #	if defined(LIBRAPID_HAS_OPENCL)
 		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
 			requires(!typetraits::HasCustomEval<
@@ -11,18 +11,53 @@ namespace librapid {
         // Should ASSERT functions print their message to stdout?
         extern bool printOnAssert;
 
-        /// Arrays with more elements than this will run with multithreaded implementations
+        /// Arrays with more elements than this will run with multithreaded implementations. For
+        /// elementwise expressions, this is only used if calibrateThresholds is false.
         extern size_t multithreadThreshold;
 
+        /// If true, the size above which each kind of elementwise expression is evaluated in
+        /// parallel is measured on this machine the first time it is evaluated, and saved to
+        /// calibrationCacheFile. This is off by default, since it writes to the user's cache
+        /// directory and briefly times the thread pool during the first evaluation.
+        extern bool calibrateThresholds;
+
+        /// File in which calibrated thresholds are saved between runs. If empty, the thresholds
+        /// are measured again every time the program runs.
+        extern std::string calibrationCacheFile;
+
         // Number of columns required for a matrix to be parallelized in GEMM
         extern size_t gemmMultithreadThreshold;
 
         // Number of columns required for a matrix to be parallelized in GEMV
         extern size_t gemvMultithreadThreshold;
 
-        // Number of threads used by LibRapid
+        // Number of threads used by LibRapid (the thread pool resizes itself to match)
         extern size_t numThreads;
 
+        /// If true, the worker threads of the thread pool are pinned to separate CPUs, so the
+        /// operating system cannot move them away from the memory they work on. The thread
+        /// which submits the work is not pinned.
+        extern bool pinThreads;
+
+        /// If true, the pages of every newly allocated Storage of at least
+        /// numaFirstTouchThreshold bytes are first written by the thread pool, in parallel, so
+        /// each page is placed on the NUMA node of the thread which will process it. This is
+        /// most effective when pinThreads is also true.
+        extern bool numaFirstTouch;
+
+        /// The smallest allocation, in bytes, touched in parallel when numaFirstTouch is true
+        extern size_t numaFirstTouchThreshold;
+
+        /// Allocations of at least this many bytes are backed by huge pages (2 MiB on x86), which
+        /// greatly reduces TLB misses when working with very large arrays. Currently only
+        /// supported on Linux. Huge pages are not used by default (the threshold is SIZE_MAX),
+        /// since they can increase memory usage; 32 MiB is a sensible value to enable them.
+        extern size_t hugePageThreshold;
+
+        /// The largest number of bytes of freed CPU array memory kept for reuse by later
+        /// allocations (see trimAllocationCache). Set it to 0 to disable the cache.
+        extern size_t allocationCacheLimit;
+
         // Random seed used by LibRapid (when changed, the random number generator is reseeded)
         extern size_t randomSeed;
 
@@ -32,6 +67,44 @@ namespace librapid {
         // Size of a cache line in bytes
         extern size_t cacheLineSize;
 
+        // Size of the L2 cache in bytes (used to size tiles for cache-blocked evaluation)
+        extern size_t l2CacheSize;
+
+        /// Assignments writing at least this many bytes use non-temporal (streaming) stores, which
+        /// bypass the cache. By default, this is a few times the size of the last-level cache. Set
+        /// it to 0 to always use streaming stores, or SIZE_MAX to never use them.
+        extern size_t streamingStoreThreshold;
+
+        /// Changes a global setting for the lifetime of this object, and restores its previous
+        /// value when the object is destroyed (including when an exception is thrown)
+        ///
+        /// \code{.cpp}
+        /// {
+        ///     lrc::global::ScopedSetting serial(lrc::global::numThreads, size_t(1));
+        ///     // Everything in this scope runs on a single thread
+        /// }
+        /// \endcode
+        /// \tparam T The type of the setting
+        template<typename T>
+        class ScopedSetting {
+        public:
+            /// Set \p setting to \p value until this object is destroyed
+            /// \param setting The global variable to change
+            /// \param value The value to give it
+            ScopedSetting(T &setting, T value) : m_setting(setting), m_previous(setting) {
+                m_setting = std::move(value);
+            }
+
+            ScopedSetting(const ScopedSetting &)            = delete;
+            ScopedSetting &operator=(const ScopedSetting &) = delete;
+
+            ~ScopedSetting() { m_setting = std::move(m_previous); }
+
+        private:
+            T &m_setting;
+            T m_previous;
+        };
+
 #if defined(LIBRAPID_HAS_OPENCL)
         // OpenCL device list
         extern std::vector<cl::Device> openclDevices;
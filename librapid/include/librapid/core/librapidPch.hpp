@@ -10,6 +10,7 @@
 
 // Standard Library
 #include <array>
+#include <atomic>
 #include <cfloat>
 #include <chrono>
 #include <cmath>
@@ -18,7 +19,9 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <random>
+#include <typeinfo>
 
 #if defined(LIBRAPID_HAS_OMP)
 #    include <omp.h>
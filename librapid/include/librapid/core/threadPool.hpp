@@ -0,0 +1,126 @@
+#ifndef LIBRAPID_CORE_THREAD_POOL_HPP
+#define LIBRAPID_CORE_THREAD_POOL_HPP
+
+/*
+ * LibRapid's persistent thread pool. Every parallel CPU operation runs through parallelFor,
+ * which hands out chunks of an index range to a fixed set of worker threads. The workers are
+ * created once and kept alive between calls, so small and medium-sized operations do not pay
+ * the cost of creating (or waking up) a new team of threads every time.
+ */
+
+namespace librapid {
+	namespace detail {
+		/// A lightweight, non-owning reference to a callable object taking a half-open range of
+		/// indices. Unlike std::function, this never allocates.
+		class RangeFunctionRef {
+		public:
+			template<typename Fn>
+			RangeFunctionRef(Fn &fn) :
+					m_object(const_cast<void *>(static_cast<const void *>(&fn))),
+					m_invoke([](void *object, int64_t first, int64_t last) {
+						(*static_cast<Fn *>(object))(first, last);
+					}) {}
+
+			LIBRAPID_ALWAYS_INLINE void operator()(int64_t first, int64_t last) const {
+				m_invoke(m_object, first, last);
+			}
+
+		private:
+			void *m_object;
+			void (*m_invoke)(void *, int64_t, int64_t);
+		};
+
+		/// A pool of persistent worker threads with work-stealing range scheduling.
+		///
+		/// A range is split into chunks, and each thread (including the caller) starts with an
+		/// equal, contiguous share of them. Once a thread runs out of work, it steals half of the
+		/// remaining work of another thread, so uneven workloads are still balanced. Idle workers
+		/// spin for a short time before going to sleep, so back-to-back operations are cheap.
+		///
+		/// Calls made from inside a parallel region (i.e. nested parallelism) run serially on the
+		/// calling thread rather than oversubscribing the processor. Calls made while the pool is
+		/// busy with a job from another thread wait for that job to finish.
+		///
+		/// If global::pinThreads is true, each worker thread is pinned to its own CPU, so the
+		/// thread processing a given part of a range (and the memory it touches) stays put.
+		class ThreadPool {
+		public:
+			ThreadPool(const ThreadPool &)			  = delete;
+			ThreadPool(ThreadPool &&)				  = delete;
+			ThreadPool &operator=(const ThreadPool &) = delete;
+			ThreadPool &operator=(ThreadPool &&)	  = delete;
+			~ThreadPool();
+
+			/// Return the global thread pool, creating it if necessary
+			static ThreadPool &instance();
+
+			/// Returns true if the calling thread is currently executing part of a parallel
+			/// region
+			static bool inParallelRegion();
+
+			/// Execute \p body over [begin, end), split into chunks. Every chunk boundary lies
+			/// a multiple of \p grain iterations after \p begin, and every chunk (except possibly
+			/// the last) contains a multiple of \p grain iterations. The pool resizes itself to
+			/// match global::numThreads.
+			/// \param begin The first index
+			/// \param end One past the last index
+			/// \param grain The granularity of the chunks
+			/// \param body The callable to invoke for each chunk
+			void run(int64_t begin, int64_t end, int64_t grain, RangeFunctionRef body);
+
+		private:
+			ThreadPool();
+
+			struct Impl;
+			std::unique_ptr<Impl> m_impl;
+		};
+
+		/// Touch every page of a newly allocated block of memory in parallel, using the same
+		/// partition of the range as the thread pool uses for parallel loops. Operating systems
+		/// place a page on the NUMA node of the thread which first writes to it, so this puts
+		/// each part of the block next to the thread which will (most likely) process it. Does
+		/// nothing if only one thread is in use.
+		/// \param data The start of the block. The contents are overwritten
+		/// \param bytes The size of the block, in bytes
+		void firstTouch(void *data, size_t bytes);
+	} // namespace detail
+
+	/// \brief Execute a loop in parallel on LibRapid's thread pool
+	///
+	/// \p fn is either called once per index, as `fn(index)`, or once per chunk of the range,
+	/// as `fn(first, last)`, processing the indices [first, last). The chunked form avoids a
+	/// call per index, and allows the body to be vectorised.
+	///
+	/// \code{.cpp}
+	/// // Process packets of 8 elements, so each chunk starts on a packet boundary
+	/// lrc::parallelFor(0, n, [&](int64_t first, int64_t last) {
+	///     for (int64_t i = first; i < last; i += 8) { ... }
+	/// }, 8);
+	/// \endcode
+	///
+	/// Exceptions thrown by \p fn are rethrown on the calling thread once every chunk has
+	/// finished. If more than one chunk throws, only the first exception is rethrown.
+	///
+	/// \tparam Fn The type of the loop body
+	/// \param begin The first index
+	/// \param end One past the last index
+	/// \param fn The loop body
+	/// \param grain Chunks contain (and start at) multiples of this many iterations. Use this
+	/// to keep chunks aligned with packet or cache-line boundaries
+	template<typename Fn>
+	LIBRAPID_ALWAYS_INLINE void parallelFor(int64_t begin, int64_t end, Fn &&fn,
+											int64_t grain = 1) {
+		if (end <= begin) return;
+
+		if constexpr (std::is_invocable_v<Fn &, int64_t, int64_t>) {
+			detail::ThreadPool::instance().run(begin, end, grain, detail::RangeFunctionRef(fn));
+		} else {
+			auto body = [&fn](int64_t first, int64_t last) {
+				for (int64_t index = first; index < last; ++index) { fn(index); }
+			};
+			detail::ThreadPool::instance().run(begin, end, grain, detail::RangeFunctionRef(body));
+		}
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_CORE_THREAD_POOL_HPP
@@ -0,0 +1,47 @@
+#ifndef LIBRAPID_SIMD_GATHER
+#define LIBRAPID_SIMD_GATHER
+
+namespace librapid::detail {
+	/// The signed integer type used to index the lanes of a gather into a packet of \p Scalar
+	/// values. It must have the same number of lanes as the packet, so it has the same size as
+	/// the scalar type.
+	template<typename Scalar>
+	using GatherIndex = std::conditional_t<
+	  sizeof(Scalar) == 8, int64_t,
+	  std::conditional_t<sizeof(Scalar) == 4, int32_t,
+						 std::conditional_t<sizeof(Scalar) == 2, int16_t, int8_t>>>;
+
+	/// Load a packet of elements which are \p stride elements apart in memory, using a single
+	/// gather instruction where the target supports one
+	/// \tparam Packet The packet type to return
+	/// \tparam Scalar The scalar type of the packet
+	/// \param first Pointer to the first element
+	/// \param stride The distance between consecutive elements
+	/// \return The gathered packet
+	template<typename Packet, typename Scalar>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet gatherStrided(const Scalar *first,
+																   int64_t stride) {
+		constexpr int64_t packetWidth = static_cast<int64_t>(Packet::size);
+		using Index					  = GatherIndex<Scalar>;
+
+		if constexpr (std::is_arithmetic_v<Scalar>) {
+			// The offset of the last lane must fit in the index type
+			constexpr int64_t maxOffset = static_cast<int64_t>(std::numeric_limits<Index>::max());
+			if (stride >= 0 && stride * (packetWidth - 1) <= maxOffset) LIBRAPID_LIKELY {
+					alignas(LIBRAPID_MEM_ALIGN) Index offsets[packetWidth];
+					for (int64_t lane = 0; lane < packetWidth; ++lane) {
+						offsets[lane] = static_cast<Index>(lane * stride);
+					}
+
+					using IndexPacket = xsimd::batch<Index, typename Packet::arch_type>;
+					return Packet::gather(first, IndexPacket::load_aligned(offsets));
+				}
+		}
+
+		alignas(LIBRAPID_MEM_ALIGN) Scalar buffer[packetWidth];
+		for (int64_t lane = 0; lane < packetWidth; ++lane) { buffer[lane] = first[lane * stride]; }
+		return Packet::load_aligned(buffer);
+	}
+} // namespace librapid::detail
+
+#endif // LIBRAPID_SIMD_GATHER
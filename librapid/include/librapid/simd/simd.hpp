@@ -2,5 +2,6 @@
 #define LIBRAPID_SIMD
 
 #include "vecOps.hpp"
+#include "gather.hpp"
 
 #endif // LIBRAPID_SIMD
\ No newline at end of file
@@ -6,6 +6,13 @@ namespace librapid {
     /// determined, the return value is 64.
     /// \return Cache line size in bytes
     size_t cacheLineSize();
+
+    /// Returns the size of the data (or unified) cache at the given level of the processor's
+    /// cache hierarchy, in bytes. If the cache size cannot be determined, the return value is
+    /// 32KiB for the L1 cache, 256KiB for the L2 cache and 0 for any other level.
+    /// \param level Cache level (1 for L1, 2 for L2, etc.)
+    /// \return Cache size in bytes
+    size_t cacheSize(size_t level);
 } // namespace librapid
 
 #endif // LIBRAPID_UTILS_CACHE_LINE_SIZE_HPP
\ No newline at end of file
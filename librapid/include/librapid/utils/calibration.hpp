@@ -0,0 +1,57 @@
+#ifndef LIBRAPID_UTILS_CALIBRATION_HPP
+#define LIBRAPID_UTILS_CALIBRATION_HPP
+
+/*
+ * Machine-specific calibration of the size above which operations are run in parallel.
+ *
+ * The cost of evaluating an element varies enormously between operations (compare addition
+ * with an exponential), so a single threshold cannot be right for all of them. Instead, the
+ * first time a kind of expression is evaluated, LibRapid times a small sample of it and
+ * compares the cost with the measured overhead of dispatching work to the thread pool. The
+ * resulting thresholds are saved to global::calibrationCacheFile, so each expression is only
+ * ever measured once per machine.
+ *
+ * Calibration is only performed if global::calibrateThresholds is set. Otherwise every
+ * expression uses global::multithreadThreshold.
+ */
+
+namespace librapid {
+	namespace detail::calibration {
+		/// Return the calibrated threshold stored for \p key, or 0 if there is none
+		/// \param key Identifies the operation
+		/// \return The threshold, in elements
+		LIBRAPID_NODISCARD size_t lookup(const std::string &key);
+
+		/// Store a calibrated threshold, and save it to the cache file
+		/// \param key Identifies the operation
+		/// \param threshold The threshold, in elements
+		void store(const std::string &key, size_t threshold);
+
+		/// Incremented whenever previously calibrated thresholds become invalid (e.g. because
+		/// the number of threads has changed)
+		LIBRAPID_NODISCARD uint64_t epoch();
+
+		/// Return the measured time taken to dispatch an (empty) job to the thread pool and wait
+		/// for it to finish, in nanoseconds. This is measured the first time it is needed.
+		LIBRAPID_NODISCARD double dispatchOverhead();
+
+		/// Compute the number of elements above which parallel evaluation is faster than serial
+		/// evaluation, for an operation costing \p nanosecondsPerElement
+		/// \param nanosecondsPerElement The serial cost of evaluating one element
+		/// \return The threshold, in elements
+		LIBRAPID_NODISCARD size_t thresholdFromCost(double nanosecondsPerElement);
+
+		/// Return the default location of the calibration cache file. This is taken from the
+		/// LIBRAPID_CALIBRATION_CACHE environment variable if it is set, and otherwise lives in
+		/// the user's cache directory.
+		LIBRAPID_NODISCARD std::string defaultCacheFile();
+	} // namespace detail::calibration
+
+	/// \brief Discard every calibrated multithreading threshold
+	///
+	/// Thresholds are measured again the next time each operation is evaluated. The cache file
+	/// is deleted.
+	void resetCalibration();
+} // namespace librapid
+
+#endif // LIBRAPID_UTILS_CALIBRATION_HPP
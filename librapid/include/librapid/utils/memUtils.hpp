@@ -181,6 +181,85 @@ namespace librapid {
 		(void)addr; (void)len;
 #endif
 	}
+
+	/// Statistics describing the memory allocated for CPU arrays
+	struct AllocationStats {
+		size_t allocations		   = 0; // Number of blocks allocated
+		size_t deallocations	   = 0; // Number of blocks freed
+		size_t bytesInUse		   = 0; // Bytes currently allocated
+		size_t peakBytesInUse	   = 0; // Largest value of bytesInUse seen so far
+		size_t hugePageAllocations = 0; // Number of huge page mappings created
+		size_t hugePageBytesInUse  = 0; // Bytes currently mapped with huge pages
+		size_t cachedBytes		   = 0; // Bytes of freed blocks kept for reuse
+		size_t cacheHits		   = 0; // Number of allocations served from the cache
+	};
+
+	/// \brief Return statistics about the memory allocated for CPU arrays
+	///
+	/// Blocks larger than a few kilobytes are rounded up to a size class (see
+	/// trimAllocationCache), and are counted at their rounded size. Huge page mappings are
+	/// counted at their mapped size, which is a whole number of huge pages, and include any
+	/// which are currently cached.
+	/// \return The current statistics
+	LIBRAPID_NODISCARD AllocationStats allocationStats();
+
+	/// \brief Reset the allocation, deallocation and cache hit counters, and set the peak memory
+	/// usage to the current usage
+	void resetAllocationStats();
+
+	/// \brief Release cached memory back to the system
+	///
+	/// Freed CPU arrays between a few kilobytes and 1 GiB are not returned to the system
+	/// straight away. Instead, they are binned by size (each power of two is split into four
+	/// size classes) and reused by later allocations of a similar size, which avoids the cost of
+	/// page faults and zeroing in loops which repeatedly create temporary arrays. At most
+	/// global::allocationCacheLimit bytes are kept. This function releases cached blocks,
+	/// largest first, until at most \p keepBytes remain.
+	/// \param keepBytes The number of cached bytes which may be kept
+	void trimAllocationCache(size_t keepBytes = 0);
+
+	namespace detail {
+		/// The size (and alignment) of a huge page
+		constexpr size_t hugePageSize = size_t(2) * 1024 * 1024;
+
+		/// Allocate \p bytes of memory backed by huge pages, aligned to hugePageSize. Explicit
+		/// (hugetlbfs) pages are used if any are available, and transparent huge pages are
+		/// requested otherwise. Returns nullptr if huge pages are not supported on this
+		/// platform, or the memory could not be mapped.
+		/// \param bytes The number of bytes to allocate
+		/// \return A pointer to the memory, or nullptr
+		LIBRAPID_NODISCARD void *hugePageAllocate(size_t bytes);
+
+		/// Release \p ptr if it was allocated by hugePageAllocate. Blocks smaller than any huge
+		/// page allocation are rejected without taking a lock.
+		/// \param ptr The pointer to release
+		/// \param bytes The size the block was allocated with
+		/// \return True if the memory was released, false if it did not come from
+		/// hugePageAllocate (in which case nothing is done)
+		bool hugePageDeallocate(void *ptr, size_t bytes);
+
+		/// Allocate \p bytes of memory for an array, aligned to at least LIBRAPID_MEM_ALIGN.
+		/// The block is taken from the allocation cache if possible, and is otherwise allocated
+		/// with huge pages or the system allocator, depending on its size.
+		/// \param bytes The number of bytes to allocate
+		/// \return A pointer to the memory
+		LIBRAPID_NODISCARD void *allocateBytes(size_t bytes);
+
+		/// Resize a block allocated with allocateBytes without copying its contents. This is
+		/// only possible for blocks backed by huge pages on Linux, which are resized (and moved,
+		/// if necessary) with mremap. Any new memory is zeroed.
+		/// \param ptr The block to resize
+		/// \param oldBytes The number of bytes passed to allocateBytes
+		/// \param newBytes The new size of the block, in bytes
+		/// \return The new location of the block, or nullptr if it could not be resized (in
+		/// which case it is unchanged)
+		LIBRAPID_NODISCARD void *reallocateBytes(void *ptr, size_t oldBytes, size_t newBytes);
+
+		/// Free memory allocated with allocateBytes
+		/// \param ptr The pointer to free
+		/// \param bytes The number of bytes passed to allocateBytes
+		void deallocateBytes(void *ptr, size_t bytes);
+	} // namespace detail
 } // namespace librapid
 
 #endif // LIBRAPID_UTILS_MEMUTILS_HPP
\ No newline at end of file
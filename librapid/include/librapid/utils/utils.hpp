@@ -3,6 +3,7 @@
 
 #include "cacheLineSize.hpp"
 #include "time.hpp"
+#include "calibration.hpp"
 #include "memUtils.hpp"
 #include "consoleSize.hpp"
 #include "serialize.hpp"
@@ -0,0 +1,434 @@
+#include <librapid/librapid.hpp>
+
+#include <bit>
+#include <mutex>
+#include <unordered_map>
+
+namespace librapid {
+    namespace detail {
+        namespace {
+            constexpr auto relaxed = std::memory_order_relaxed;
+
+            // Blocks of at most this many bytes are not cached, since the system allocator
+            // already handles small blocks well
+            constexpr size_t smallestCachedBlock = 4096;
+
+            // Blocks larger than this are not cached either (nor rounded up to a size class),
+            // since keeping even one of them would exceed the default allocationCacheLimit.
+            // This must not depend on a runtime setting, because a block must be given the
+            // same size class when it is freed as when it was allocated.
+            constexpr size_t largestCachedBlock = size_t(1) << 30;
+
+            // Each power of two is split into this many size classes, so at most 25% of a
+            // block is wasted by rounding its size up
+            constexpr int classesPerDoubling = 4;
+            constexpr int firstClassExponent = std::bit_width(smallestCachedBlock) - 1;
+            constexpr int lastClassExponent  = std::bit_width(largestCachedBlock) - 2;
+            constexpr size_t numSizeClasses =
+              (lastClassExponent - firstClassExponent + 1) * classesPerDoubling;
+
+            // Sentinel returned by sizeClass for blocks which are not cached
+            constexpr size_t uncached = ~size_t(0);
+
+            std::atomic<size_t> allocations {0};
+            std::atomic<size_t> deallocations {0};
+            std::atomic<size_t> bytesInUse {0};
+            std::atomic<size_t> peakBytesInUse {0};
+            std::atomic<size_t> hugePageAllocations {0};
+            std::atomic<size_t> hugePageBytesInUse {0};
+
+            // The smallest block ever allocated with huge pages. Smaller blocks cannot be huge
+            // page mappings, so they are freed without looking in the registry.
+            std::atomic<size_t> smallestHugePageBlock {~size_t(0)};
+            std::atomic<size_t> cachedBytes {0};
+            std::atomic<size_t> cacheHits {0};
+
+            /// The length of every live huge page mapping, keyed by its address. This is never
+            /// destroyed, so arrays with static storage duration can still be freed at exit.
+            struct HugePageRegistry {
+                std::mutex mutex;
+                std::unordered_map<void *, size_t> mappings;
+
+                static HugePageRegistry &instance() {
+                    static auto *registry = new HugePageRegistry();
+                    return *registry;
+                }
+            };
+
+            /// Freed blocks waiting to be reused, binned by size class. Like the registry above,
+            /// this is never destroyed.
+            struct BlockCache {
+                struct Bin {
+                    std::mutex mutex;
+                    std::vector<void *> blocks;
+                };
+
+                Bin bins[numSizeClasses];
+
+                static BlockCache &instance() {
+                    static auto *cache = new BlockCache();
+                    return *cache;
+                }
+            };
+
+            /// Return the size class of a block of \p bytes, or `uncached` if blocks of this size
+            /// are not cached
+            size_t sizeClass(size_t bytes) {
+                if (bytes <= smallestCachedBlock || bytes > largestCachedBlock) return uncached;
+
+                // 2^exponent < bytes <= 2^(exponent + 1)
+                const int exponent = std::bit_width(bytes - 1) - 1;
+
+                const size_t step = (size_t(1) << exponent) / classesPerDoubling;
+                const size_t sub  = (bytes - (size_t(1) << exponent) + step - 1) / step;
+                return size_t(exponent - firstClassExponent) * classesPerDoubling + sub - 1;
+            }
+
+            /// Return the number of bytes allocated for blocks in a size class
+            size_t classBytes(size_t index) {
+                const int exponent = int(index / classesPerDoubling) + firstClassExponent;
+                const size_t step  = (size_t(1) << exponent) / classesPerDoubling;
+                return (size_t(1) << exponent) + (index % classesPerDoubling + 1) * step;
+            }
+
+            void updatePeak(size_t inUse) {
+                size_t peak = peakBytesInUse.load(relaxed);
+                while (inUse > peak &&
+                       !peakBytesInUse.compare_exchange_weak(peak, inUse, relaxed)) {}
+            }
+
+            /// Allocate \p bytes of memory aligned to LIBRAPID_MEM_ALIGN with the platform's
+            /// aligned allocator
+            void *alignedAllocate(size_t bytes) {
+#if defined(LIBRAPID_BLAS_MKLBLAS)
+                // MKL has its own memory allocation function
+                void *ptr = mkl_malloc(bytes, 64);
+#elif defined(LIBRAPID_APPLE)
+                // Use posix_memalign
+                void *ptr;
+                auto err = posix_memalign(&ptr, LIBRAPID_MEM_ALIGN, bytes);
+                LIBRAPID_ASSERT(err == 0, "posix_memalign failed with error code {}", err);
+#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
+                void *ptr = nullptr;
+                try {
+                    ptr = _aligned_malloc(bytes, LIBRAPID_MEM_ALIGN);
+                } catch (const std::exception &) {
+                    LIBRAPID_ASSERT(false, "Failed to allocate {} bytes of memory", bytes);
+                }
+#else
+                // The size passed to aligned_alloc must be a multiple of the alignment
+                constexpr size_t align = LIBRAPID_MEM_ALIGN;
+                void *ptr = std::aligned_alloc(align, (bytes + align - 1) / align * align);
+#endif
+
+                LIBRAPID_ASSERT(ptr != nullptr, "Failed to allocate {} bytes of memory", bytes);
+                return ptr;
+            }
+
+            /// Free memory allocated with alignedAllocate
+            void alignedFree(void *ptr) {
+#if defined(LIBRAPID_BLAS_MKLBLAS)
+                mkl_free(ptr);
+#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
+                _aligned_free(ptr);
+#else
+                free(ptr);
+#endif
+            }
+
+#if defined(LIBRAPID_LINUX)
+            /// Map \p length bytes of anonymous memory, aligned to hugePageSize. Slightly more
+            /// memory than required is mapped, and then trimmed to a huge page boundary.
+            void *mapAligned(size_t length, int protection) {
+                constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+                const size_t padded = length + hugePageSize;
+                void *mapping       = mmap(nullptr, padded, protection, flags, -1, 0);
+                if (mapping == MAP_FAILED) return nullptr;
+
+                char *base          = static_cast<char *>(mapping);
+                const size_t excess = reinterpret_cast<uintptr_t>(base) % hugePageSize;
+                const size_t offset = excess == 0 ? 0 : hugePageSize - excess;
+                char *aligned       = base + offset;
+
+                if (offset > 0) munmap(base, offset);
+                if (padded - offset > length) munmap(aligned + length, padded - offset - length);
+                return aligned;
+            }
+
+            /// Map \p length bytes (a multiple of hugePageSize), aligned to hugePageSize
+            void *mapHugePages(size_t length) {
+                constexpr int protection = PROT_READ | PROT_WRITE;
+
+#    if defined(MAP_HUGETLB)
+                // Explicit huge pages are reserved when the memory is mapped, so this fails
+                // cleanly if the system does not have enough of them
+                constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+                void *explicitPages = mmap(nullptr, length, protection, flags, -1, 0);
+                if (explicitPages != MAP_FAILED) return explicitPages;
+#    endif
+
+                // Otherwise, ask for transparent huge pages
+                void *aligned = mapAligned(length, protection);
+#    if defined(MADV_HUGEPAGE)
+                if (aligned != nullptr) madvise(aligned, length, MADV_HUGEPAGE);
+#    endif
+                return aligned;
+            }
+
+#    if defined(MREMAP_MAYMOVE) && defined(MREMAP_FIXED)
+            /// Resize a huge page mapping, moving it to a new (aligned) address if it cannot
+            /// grow in place. The contents are moved by remapping the pages, not by copying
+            /// them. Returns nullptr on failure, in which case the mapping is unchanged.
+            void *remapHugePages(void *ptr, size_t oldLength, size_t newLength) {
+                void *moved = mremap(ptr, oldLength, newLength, 0);
+                if (moved == MAP_FAILED) {
+                    // Reserve an aligned range of addresses and move the mapping there
+                    void *target = mapAligned(newLength, PROT_NONE);
+                    if (target == nullptr) return nullptr;
+
+                    constexpr int flags = MREMAP_MAYMOVE | MREMAP_FIXED;
+                    moved               = mremap(ptr, oldLength, newLength, flags, target);
+                    if (moved == MAP_FAILED) {
+                        munmap(target, newLength);
+                        return nullptr;
+                    }
+                }
+
+#        if defined(MADV_HUGEPAGE)
+                madvise(moved, newLength, MADV_HUGEPAGE);
+#        endif
+                return moved;
+            }
+#    endif
+#endif // LIBRAPID_LINUX
+
+            /// Allocate a new block of \p bytes bytes from the system, of which the first
+            /// \p requested bytes will be used
+            void *allocateFresh(size_t bytes, size_t requested) {
+                void *memory = nullptr;
+                if (bytes >= global::hugePageThreshold) LIBRAPID_UNLIKELY {
+                        memory = hugePageAllocate(bytes);
+                    }
+                if (memory == nullptr) memory = alignedAllocate(bytes);
+
+                // Spread the pages across NUMA nodes before anything else touches them. The
+                // rest of the size class is left for whichever thread uses it first.
+                if (global::numaFirstTouch && requested >= global::numaFirstTouchThreshold) {
+                    firstTouch(memory, requested);
+                }
+
+                return memory;
+            }
+
+            /// Return a block of \p bytes bytes to the system
+            void releaseFresh(void *ptr, size_t bytes) {
+                // Huge page mappings are tracked separately, since the threshold may have
+                // changed since the memory was allocated
+                if (!hugePageDeallocate(ptr, bytes)) alignedFree(ptr);
+            }
+
+            /// Record that a block of \p bytes bytes is backed by huge pages
+            void updateSmallestHugePageBlock(size_t bytes) {
+                size_t smallest = smallestHugePageBlock.load(relaxed);
+                while (bytes < smallest &&
+                       !smallestHugePageBlock.compare_exchange_weak(smallest, bytes, relaxed)) {}
+            }
+        } // namespace
+
+        void *hugePageAllocate(size_t bytes) {
+#if defined(LIBRAPID_LINUX)
+            if (bytes == 0) return nullptr;
+
+            const size_t length = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+            void *ptr           = mapHugePages(length);
+            if (ptr == nullptr) return nullptr;
+
+            auto &registry = HugePageRegistry::instance();
+            {
+                std::lock_guard<std::mutex> guard(registry.mutex);
+                registry.mappings.emplace(ptr, length);
+            }
+
+            updateSmallestHugePageBlock(bytes);
+            hugePageAllocations.fetch_add(1, relaxed);
+            hugePageBytesInUse.fetch_add(length, relaxed);
+            return ptr;
+#else
+            // Large pages on Windows require a privilege most users do not have, so they are
+            // not used
+            (void)bytes;
+            return nullptr;
+#endif // LIBRAPID_LINUX
+        }
+
+        bool hugePageDeallocate(void *ptr, size_t bytes) {
+#if defined(LIBRAPID_LINUX)
+            // Avoid taking the lock when the block cannot be a huge page mapping
+            if (ptr == nullptr || bytes < smallestHugePageBlock.load(relaxed) ||
+                hugePageBytesInUse.load(relaxed) == 0) {
+                return false;
+            }
+
+            auto &registry = HugePageRegistry::instance();
+            size_t length;
+            {
+                std::lock_guard<std::mutex> guard(registry.mutex);
+                auto it = registry.mappings.find(ptr);
+                if (it == registry.mappings.end()) return false;
+                length = it->second;
+                registry.mappings.erase(it);
+            }
+
+            munmap(ptr, length);
+            hugePageBytesInUse.fetch_sub(length, relaxed);
+            return true;
+#else
+            (void)ptr;
+            (void)bytes;
+            return false;
+#endif // LIBRAPID_LINUX
+        }
+
+        void *allocateBytes(size_t bytes) {
+            allocations.fetch_add(1, relaxed);
+
+            const size_t index = sizeClass(bytes);
+            if (index == uncached) {
+                updatePeak(bytesInUse.fetch_add(bytes, relaxed) + bytes);
+                return allocateFresh(bytes, bytes);
+            }
+
+            const size_t size = classBytes(index);
+            updatePeak(bytesInUse.fetch_add(size, relaxed) + size);
+
+            auto &bin = BlockCache::instance().bins[index];
+            {
+                std::lock_guard<std::mutex> guard(bin.mutex);
+                if (!bin.blocks.empty()) {
+                    void *block = bin.blocks.back();
+                    bin.blocks.pop_back();
+                    cachedBytes.fetch_sub(size, relaxed);
+                    cacheHits.fetch_add(1, relaxed);
+                    return block;
+                }
+            }
+
+            return allocateFresh(size, bytes);
+        }
+
+        void deallocateBytes(void *ptr, size_t bytes) {
+            if (ptr == nullptr) return;
+            deallocations.fetch_add(1, relaxed);
+
+            const size_t index = sizeClass(bytes);
+            if (index == uncached) {
+                bytesInUse.fetch_sub(bytes, relaxed);
+                releaseFresh(ptr, bytes);
+                return;
+            }
+
+            const size_t size = classBytes(index);
+            bytesInUse.fetch_sub(size, relaxed);
+
+            // Keep the block for later, unless that would take the cache over its limit
+            const size_t limit = global::allocationCacheLimit;
+            if (cachedBytes.fetch_add(size, relaxed) + size <= limit) {
+                auto &bin = BlockCache::instance().bins[index];
+                std::lock_guard<std::mutex> guard(bin.mutex);
+                bin.blocks.push_back(ptr);
+                return;
+            }
+
+            cachedBytes.fetch_sub(size, relaxed);
+            releaseFresh(ptr, size);
+
+            // The limit may have been lowered since the cached blocks were freed
+            if (cachedBytes.load(relaxed) > limit) trimAllocationCache(limit);
+        }
+
+        void *reallocateBytes(void *ptr, size_t oldBytes, size_t newBytes) {
+#if defined(LIBRAPID_LINUX) && defined(MREMAP_MAYMOVE) && defined(MREMAP_FIXED)
+            if (ptr == nullptr || hugePageBytesInUse.load(relaxed) == 0) return nullptr;
+
+            // Blocks are accounted for at the size of their size class
+            const size_t oldClass  = sizeClass(oldBytes);
+            const size_t newClass  = sizeClass(newBytes);
+            const size_t oldSize   = oldClass == uncached ? oldBytes : classBytes(oldClass);
+            const size_t newSize   = newClass == uncached ? newBytes : classBytes(newClass);
+            const size_t newLength = (newSize + hugePageSize - 1) / hugePageSize * hugePageSize;
+
+            auto &registry = HugePageRegistry::instance();
+            void *moved;
+            size_t oldLength;
+            {
+                std::lock_guard<std::mutex> guard(registry.mutex);
+                auto it = registry.mappings.find(ptr);
+                if (it == registry.mappings.end()) return nullptr;
+                oldLength = it->second;
+
+                moved = oldLength == newLength ? ptr : remapHugePages(ptr, oldLength, newLength);
+                if (moved == nullptr) return nullptr;
+
+                registry.mappings.erase(it);
+                registry.mappings.emplace(moved, newLength);
+            }
+
+            updateSmallestHugePageBlock(newSize);
+            hugePageBytesInUse.fetch_add(newLength, relaxed);
+            hugePageBytesInUse.fetch_sub(oldLength, relaxed);
+            updatePeak(bytesInUse.fetch_add(newSize, relaxed) + newSize - oldSize);
+            bytesInUse.fetch_sub(oldSize, relaxed);
+            return moved;
+#else
+            (void)ptr;
+            (void)oldBytes;
+            (void)newBytes;
+            return nullptr;
+#endif
+        }
+    } // namespace detail
+
+    void trimAllocationCache(size_t keepBytes) {
+        using namespace detail;
+
+        // Release the largest blocks first, since they are the most expensive to keep around
+        auto &cache = BlockCache::instance();
+        for (size_t index = numSizeClasses; index-- > 0;) {
+            if (cachedBytes.load(relaxed) <= keepBytes) return;
+
+            auto &bin         = cache.bins[index];
+            const size_t size = classBytes(index);
+            std::lock_guard<std::mutex> guard(bin.mutex);
+            while (!bin.blocks.empty() && cachedBytes.load(relaxed) > keepBytes) {
+                releaseFresh(bin.blocks.back(), size);
+                bin.blocks.pop_back();
+                cachedBytes.fetch_sub(size, relaxed);
+            }
+        }
+    }
+
+    AllocationStats allocationStats() {
+        using namespace detail;
+
+        AllocationStats stats;
+        stats.allocations         = allocations.load(relaxed);
+        stats.deallocations       = deallocations.load(relaxed);
+        stats.bytesInUse          = bytesInUse.load(relaxed);
+        stats.peakBytesInUse      = peakBytesInUse.load(relaxed);
+        stats.hugePageAllocations = hugePageAllocations.load(relaxed);
+        stats.hugePageBytesInUse  = hugePageBytesInUse.load(relaxed);
+        stats.cachedBytes         = cachedBytes.load(relaxed);
+        stats.cacheHits           = cacheHits.load(relaxed);
+        return stats;
+    }
+
+    void resetAllocationStats() {
+        using namespace detail;
+
+        allocations.store(0, relaxed);
+        deallocations.store(0, relaxed);
+        hugePageAllocations.store(0, relaxed);
+        cacheHits.store(0, relaxed);
+        peakBytesInUse.store(bytesInUse.load(relaxed), relaxed);
+    }
+} // namespace librapid
@@ -12,6 +12,16 @@
 
 #include <librapid/librapid.hpp>
 
+namespace librapid::detail {
+    size_t defaultCacheSize(size_t level) {
+        switch (level) {
+            case 1: return 32 * 1024;
+            case 2: return 256 * 1024;
+            default: return 0;
+        }
+    }
+} // namespace librapid::detail
+
 #if defined(LIBRAPID_APPLE)
 
 #    include <sys/sysctl.h>
@@ -37,6 +47,23 @@ namespace librapid {
         cachedLineSize = 64;
         return 64;
     }
+
+    size_t cacheSize(size_t level) {
+        const char *name = nullptr;
+        switch (level) {
+            case 1: name = "hw.l1dcachesize"; break;
+            case 2: name = "hw.l2cachesize"; break;
+            case 3: name = "hw.l3cachesize"; break;
+            default: return detail::defaultCacheSize(level);
+        }
+
+        uint64_t size         = 0;
+        size_t sizeOfCacheSize = sizeof(size);
+        if (sysctlbyname(name, &size, &sizeOfCacheSize, 0, 0) == 0 && size > 0) {
+            return static_cast<size_t>(size);
+        }
+        return detail::defaultCacheSize(level);
+    }
 } // namespace librapid
 
 #elif defined(LIBRAPID_WINDOWS) && !defined(LIBRAPID_NO_WINDOWS_H)
@@ -81,6 +108,32 @@ namespace librapid {
         cachedLineSize = lineSize;
         return lineSize;
     }
+
+    size_t cacheSize(size_t level) {
+        size_t size      = 0;
+        DWORD bufferSize = 0;
+
+        GetLogicalProcessorInformation(0, &bufferSize);
+        if (bufferSize == 0) return detail::defaultCacheSize(level);
+
+        SYSTEM_LOGICAL_PROCESSOR_INFORMATION *buffer =
+            (SYSTEM_LOGICAL_PROCESSOR_INFORMATION *)malloc(bufferSize);
+        if (!buffer) return detail::defaultCacheSize(level);
+
+        if (GetLogicalProcessorInformation(&buffer[0], &bufferSize)) {
+            DWORD count = bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION);
+            for (DWORD i = 0; i < count; ++i) {
+                if (buffer[i].Relationship == RelationCache && buffer[i].Cache.Level == level &&
+                    buffer[i].Cache.Type != CacheInstruction) {
+                    size = buffer[i].Cache.Size;
+                    break;
+                }
+            }
+        }
+
+        free(buffer);
+        return size != 0 ? size : detail::defaultCacheSize(level);
+    }
 } // namespace librapid
 
 #elif defined(LIBRAPID_LINUX)
@@ -120,6 +173,46 @@ namespace librapid {
         cachedLineSize = 64;
         return 64;
     }
+
+    size_t cacheSize(size_t level) {
+        // Each cache visible to cpu0 is described by a directory containing its level, type and
+        // size (e.g. "32K")
+        for (int index = 0; index < 16; ++index) {
+            const std::string dir =
+                fmt::format("/sys/devices/system/cpu/cpu0/cache/index{}/", index);
+
+            FILE *p = fopen((dir + "level").c_str(), "r");
+            if (!p) break;
+            unsigned int cacheLevel = 0;
+            int result              = fscanf(p, "%u", &cacheLevel);
+            fclose(p);
+            if (result != 1 || cacheLevel != level) continue;
+
+            char type[32] = {0};
+            p             = fopen((dir + "type").c_str(), "r");
+            if (!p) continue;
+            result = fscanf(p, "%31s", type);
+            fclose(p);
+            if (result != 1 || strcmp(type, "Instruction") == 0) continue;
+
+            unsigned int size = 0;
+            char unit         = 0;
+            p                 = fopen((dir + "size").c_str(), "r");
+            if (!p) continue;
+            result = fscanf(p, "%u%c", &size, &unit);
+            fclose(p);
+            if (result < 1 || size == 0) continue;
+
+            switch (unit) {
+                case 'K': return static_cast<size_t>(size) * 1024;
+                case 'M': return static_cast<size_t>(size) * 1024 * 1024;
+                case 'G': return static_cast<size_t>(size) * 1024 * 1024 * 1024;
+                default: return static_cast<size_t>(size);
+            }
+        }
+
+        return detail::defaultCacheSize(level);
+    }
 } // namespace librapid
 
 #else
@@ -129,6 +222,8 @@ namespace librapid {
         // On unknown platforms, return 64
         return 64;
     }
+
+    size_t cacheSize(size_t level) { return detail::defaultCacheSize(level); }
 } // namespace librapid
 
 #endif
\ No newline at end of file
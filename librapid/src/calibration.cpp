@@ -0,0 +1,242 @@
+#include <librapid/librapid.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+namespace librapid {
+    namespace detail::calibration {
+        namespace {
+            // First line of the cache file. Change this if the cost model changes, so that old
+            // results are discarded.
+            constexpr const char *cacheHeader = "# LibRapid multithreading thresholds v2";
+
+            // Parallel evaluation rarely scales perfectly (memory bandwidth is shared, chunks
+            // are uneven, etc.), so require the predicted gain to be comfortably larger than
+            // the cost of dispatching the work
+            constexpr double safetyFactor = 2.0;
+
+            constexpr size_t maximumThreshold = size_t(1) << 40;
+
+            std::mutex mutex; // Protects everything below
+            std::unordered_map<std::string, size_t> thresholds;
+            bool loaded     = false; // Has the cache file been read?
+            double overhead = -1;    // Measured dispatch overhead (negative if unknown)
+
+            std::atomic<uint64_t> currentEpoch {1};
+            std::atomic<size_t> calibratedThreads {0}; // Thread count the thresholds are for
+
+#if defined(LIBRAPID_DEBUG)
+            constexpr const char *buildType = "debug";
+#else
+            constexpr const char *buildType = "release";
+#endif
+
+            /// Identifies the configuration the thresholds were measured with. Thresholds from
+            /// a debug build, or one targeting a different instruction set, are meaningless.
+            std::string configuration() {
+                return fmt::format("threads {} {} arch {} build {}",
+                                   global::numThreads,
+                                   std::thread::hardware_concurrency(),
+                                   LIBRAPID_ARCH_NAME,
+                                   buildType);
+            }
+
+            /// The number of threads which can actually run at once
+            size_t effectiveThreads() {
+                const size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+                return std::min(global::numThreads, cores);
+            }
+
+            /// Discard every threshold if the number of threads has changed since they were
+            /// calculated. Must be called with the mutex held.
+            void synchronise() {
+                if (calibratedThreads.load(std::memory_order_relaxed) == global::numThreads) {
+                    return;
+                }
+
+                thresholds.clear();
+                loaded   = false;
+                overhead = -1;
+                calibratedThreads.store(global::numThreads, std::memory_order_relaxed);
+                currentEpoch.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /// Read the cache file, if it exists and matches the current configuration. Must be
+            /// called with the mutex held.
+            void load() {
+                loaded = true;
+                if (global::calibrationCacheFile.empty()) return;
+
+                std::ifstream file(global::calibrationCacheFile);
+                std::string line;
+                if (!std::getline(file, line) || line != cacheHeader) return;
+                if (!std::getline(file, line) || line != configuration()) return;
+
+                while (std::getline(file, line)) {
+                    std::istringstream stream(line);
+                    size_t threshold = 0;
+                    std::string key;
+                    if (stream >> threshold >> std::ws && std::getline(stream, key) &&
+                        threshold > 0) {
+                        thresholds.emplace(key, threshold);
+                    }
+                }
+            }
+
+            /// Write every threshold to the cache file. The file is written under a temporary
+            /// name and then renamed over the old one, so other processes never read a partial
+            /// file. Failures are ignored, since the cache only saves time. Must be called with
+            /// the mutex held.
+            void save() {
+                if (global::calibrationCacheFile.empty()) return;
+
+                const std::filesystem::path path(global::calibrationCacheFile);
+                std::error_code error;
+                if (path.has_parent_path()) {
+                    std::filesystem::create_directories(path.parent_path(), error);
+                }
+
+                std::filesystem::path temporary(path);
+                temporary += fmt::format(".{:x}.tmp", std::random_device {}());
+
+                {
+                    std::ofstream file(temporary, std::ios::trunc);
+                    if (!file) return;
+
+                    file << cacheHeader << '\n' << configuration() << '\n';
+                    for (const auto &[key, threshold] : thresholds) {
+                        file << threshold << ' ' << key << '\n';
+                    }
+
+                    file.close();
+                    if (!file) {
+                        std::filesystem::remove(temporary, error);
+                        return;
+                    }
+                }
+
+                std::filesystem::rename(temporary, path, error);
+                if (error) std::filesystem::remove(temporary, error);
+            }
+
+            /// Time an empty job on the thread pool. The median of several runs is used, since
+            /// the fastest run is rarely representative.
+            double measureOverhead() {
+                const int64_t iterations = static_cast<int64_t>(global::numThreads) * 64;
+                auto noop                = [](int64_t, int64_t) {};
+
+                // The first job starts the worker threads
+                parallelFor(0, iterations, noop);
+
+                std::vector<double> times(31);
+                for (auto &elapsed : times) {
+                    const double start = now<time::nanosecond>();
+                    parallelFor(0, iterations, noop);
+                    elapsed = now<time::nanosecond>() - start;
+                }
+
+                std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+                return times[times.size() / 2];
+            }
+        } // namespace
+
+        size_t lookup(const std::string &key) {
+            std::lock_guard<std::mutex> guard(mutex);
+            synchronise();
+            if (!loaded) load();
+
+            auto it = thresholds.find(key);
+            return it == thresholds.end() ? 0 : it->second;
+        }
+
+        void store(const std::string &key, size_t threshold) {
+            std::lock_guard<std::mutex> guard(mutex);
+            synchronise();
+            if (!loaded) load();
+
+            thresholds[key] = threshold;
+            save();
+        }
+
+        uint64_t epoch() {
+            if (calibratedThreads.load(std::memory_order_relaxed) != global::numThreads) {
+                std::lock_guard<std::mutex> guard(mutex);
+                synchronise();
+            }
+            return currentEpoch.load(std::memory_order_relaxed);
+        }
+
+        double dispatchOverhead() {
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                synchronise();
+                if (overhead >= 0) return overhead;
+            }
+
+            // The mutex is not held while measuring, since the thread pool may be busy with
+            // jobs which are themselves waiting for it, in which case the measurement would
+            // run serially and report no overhead at all
+            const double measured = measureOverhead();
+
+            std::lock_guard<std::mutex> guard(mutex);
+            synchronise();
+            if (overhead < 0) overhead = measured;
+            return overhead;
+        }
+
+        size_t thresholdFromCost(double nanosecondsPerElement) {
+            const double threads = static_cast<double>(effectiveThreads());
+            if (threads <= 1) return maximumThreshold;
+
+            // Evaluating n elements takes roughly n * cost serially, and
+            // n * cost / threads + overhead in parallel
+            const double cost     = std::max(nanosecondsPerElement, 1e-3);
+            const double gain     = cost * (1.0 - 1.0 / threads);
+            const double elements = safetyFactor * dispatchOverhead() / gain;
+
+            return static_cast<size_t>(
+              std::clamp(elements, 1024.0, static_cast<double>(maximumThreshold)));
+        }
+
+        std::string defaultCacheFile() {
+            namespace fs = std::filesystem;
+
+            if (const char *path = std::getenv("LIBRAPID_CALIBRATION_CACHE")) return path;
+
+#if defined(LIBRAPID_WINDOWS)
+            if (const char *dir = std::getenv("LOCALAPPDATA")) {
+                return (fs::path(dir) / "librapid" / "thresholds.txt").string();
+            }
+#else
+            if (const char *dir = std::getenv("XDG_CACHE_HOME"); dir != nullptr && *dir != '\0') {
+                return (fs::path(dir) / "librapid" / "thresholds.txt").string();
+            }
+            if (const char *home = std::getenv("HOME")) {
+                return (fs::path(home) / ".cache" / "librapid" / "thresholds.txt").string();
+            }
+#endif
+
+            return "";
+        }
+    } // namespace detail::calibration
+
+    void resetCalibration() {
+        using namespace detail::calibration;
+
+        std::lock_guard<std::mutex> guard(mutex);
+        thresholds.clear();
+        loaded   = true; // Do not reload the old results
+        overhead = -1;
+        currentEpoch.fetch_add(1, std::memory_order_relaxed);
+
+        if (!global::calibrationCacheFile.empty()) {
+            std::error_code error;
+            std::filesystem::remove(global::calibrationCacheFile, error);
+        }
+    }
+} // namespace librapid
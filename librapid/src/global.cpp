@@ -4,14 +4,23 @@
 
 namespace librapid {
     namespace global {
-        bool printOnAssert              = true;
-        size_t multithreadThreshold     = 5000;
-        size_t gemmMultithreadThreshold = 100;
-        size_t gemvMultithreadThreshold = 100;
-        size_t numThreads               = 8;
-        size_t randomSeed               = 0; // Set in PreMain
-        bool reseed                     = false;
-        size_t cacheLineSize            = 64;
+        bool printOnAssert               = true;
+        size_t multithreadThreshold      = 5000;
+        bool calibrateThresholds         = false;
+        std::string calibrationCacheFile = detail::calibration::defaultCacheFile();
+        size_t gemmMultithreadThreshold  = 100;
+        size_t gemvMultithreadThreshold  = 100;
+        size_t numThreads                = 8;
+        bool pinThreads                  = false;
+        bool numaFirstTouch              = false;
+        size_t numaFirstTouchThreshold   = 4 * 1024 * 1024;
+        size_t hugePageThreshold         = SIZE_MAX;
+        size_t allocationCacheLimit      = size_t(1) << 30;
+        size_t randomSeed                = 0; // Set in PreMain
+        bool reseed                      = false;
+        size_t cacheLineSize             = 64;
+        size_t l2CacheSize               = 256 * 1024;
+        size_t streamingStoreThreshold   = 64 * 1024 * 1024;
 
 #if defined(LIBRAPID_HAS_OPENCL)
         std::vector<cl::Device> openclDevices;
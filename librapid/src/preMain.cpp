@@ -12,6 +12,13 @@ namespace librapid::detail {
 
             preMainRun            = true;
             global::cacheLineSize = cacheLineSize();
+            global::l2CacheSize   = cacheSize(2);
+
+            // Streaming stores only pay off once the output is much larger than the last-level
+            // cache, so the data would have been evicted before it was read again anyway
+            if (size_t l3CacheSize = cacheSize(3); l3CacheSize > 0) {
+                global::streamingStoreThreshold = 4 * l3CacheSize;
+            }
 
             // OpenCL compatible devices are detected after this function is called,
             // meaning nothing is found here. The user must call configureOpenCL()
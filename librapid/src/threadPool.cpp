@@ -0,0 +1,345 @@
+#include <librapid/librapid.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#if defined(LIBRAPID_LINUX)
+#    include <sched.h>
+#endif
+
+namespace librapid::detail {
+    namespace {
+        // Number of times an idle worker polls for new work before going to sleep
+        constexpr int64_t spinIterations = 1 << 14;
+
+        // Number of polls after which a waiting thread yields its time slice instead of spinning,
+        // so waiting is cheap when there are more threads than cores
+        constexpr int64_t pauseIterations = 64;
+
+        // A job is identified by a counter in the upper bits of its ticket, and the number of
+        // threads taking part in it in the lower bits, so workers can read both atomically
+        constexpr int ticketShift = 16;
+
+        // True while the current thread is executing part of a parallel region
+        thread_local bool inRegion = false;
+
+        LIBRAPID_ALWAYS_INLINE void cpuRelax() {
+#if LIBRAPID_ARCH >= ARCH_SSE2
+            _mm_pause();
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        /// Back off while polling. Spin briefly at first, then start yielding.
+        LIBRAPID_ALWAYS_INLINE void backOff(int64_t iteration) {
+            if (iteration < pauseIterations) {
+                cpuRelax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        // Distance between the bytes touched by firstTouch. This is the smallest page size in
+        // common use, so every page is touched however large the pages really are.
+        constexpr size_t touchStride = 4096;
+
+        /// Return the CPUs the calling thread may run on, in ascending order. The result is
+        /// empty if this is not supported on the current platform.
+        std::vector<size_t> availableCpus() {
+            std::vector<size_t> cpus;
+#if defined(LIBRAPID_LINUX)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+                }
+            }
+#elif defined(LIBRAPID_WINDOWS) && !defined(LIBRAPID_NO_WINDOWS_H)
+            DWORD_PTR processMask, systemMask;
+            if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+                for (size_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu) {
+                    if (processMask & (DWORD_PTR(1) << cpu)) cpus.push_back(cpu);
+                }
+            }
+#endif
+            return cpus;
+        }
+
+        /// Restrict the calling thread to a single CPU. Failures are ignored, since pinning is
+        /// only an optimisation.
+        void pinCurrentThread(size_t cpu) {
+#if defined(LIBRAPID_LINUX)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+#elif defined(LIBRAPID_WINDOWS) && !defined(LIBRAPID_NO_WINDOWS_H)
+            SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+#else
+            (void)cpu;
+#endif
+        }
+
+        /// A minimal spin lock, used to protect each thread's remaining range. It is only ever
+        /// held for a handful of instructions.
+        class SpinLock {
+        public:
+            void lock() {
+                while (m_flag.test_and_set(std::memory_order_acquire)) { cpuRelax(); }
+            }
+
+            void unlock() { m_flag.clear(std::memory_order_release); }
+
+        private:
+            std::atomic_flag m_flag = ATOMIC_FLAG_INIT;
+        };
+
+        /// The range of work remaining for a single thread. Padded to a cache line so threads
+        /// do not contend on each other's ranges.
+        struct alignas(64) WorkRange {
+            SpinLock lock;
+            int64_t next = 0;
+            int64_t end  = 0;
+        };
+    } // namespace
+
+    struct ThreadPool::Impl {
+        std::vector<std::thread> workers;
+        std::unique_ptr<WorkRange[]> ranges;
+
+        std::mutex submitMutex; // Held while a job is running
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        std::atomic<uint64_t> ticket {0}; // Identifies the current job (see ticketShift)
+        std::atomic<int64_t> pending {0}; // Workers which have not finished the current job
+        bool stop   = false;
+        bool pinned = false; // Are the workers pinned to CPUs?
+
+        // The current job
+        int64_t grain          = 1;
+        int64_t chunk          = 1;
+        size_t participants    = 0;
+        RangeFunctionRef *body = nullptr;
+
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        ~Impl() { resize(0, false); }
+
+        /// Start or stop worker threads so that there are exactly \p count of them. If \p pin is
+        /// true, worker i is pinned to the i-th CPU available to the process (wrapping around if
+        /// there are more workers than CPUs). The first CPU is left for the calling thread.
+        void resize(size_t count, bool pin) {
+            if (!workers.empty()) {
+                {
+                    std::lock_guard<std::mutex> guard(sleepMutex);
+                    stop = true;
+                }
+                wake.notify_all();
+                for (auto &worker : workers) worker.join();
+                workers.clear();
+                stop = false;
+            }
+
+            // New workers must not pick up any job submitted before they were created, even if
+            // they only start running after the next job has been submitted
+            const uint64_t seen = ticket.load(std::memory_order_relaxed);
+
+            const std::vector<size_t> cpus = pin ? availableCpus() : std::vector<size_t>();
+            pinned                         = pin;
+
+            ranges = std::make_unique<WorkRange[]>(count + 1);
+            workers.reserve(count);
+            for (size_t id = 1; id <= count; ++id) {
+                const int64_t cpu = cpus.empty() ? -1 : int64_t(cpus[id % cpus.size()]);
+                workers.emplace_back([this, id, seen, cpu]() { workerLoop(id, seen, cpu); });
+            }
+        }
+
+        void workerLoop(size_t id, uint64_t seen, int64_t cpu) {
+            inRegion = true;
+            if (cpu >= 0) pinCurrentThread(size_t(cpu));
+
+            while (true) {
+                // Poll for a short while, since new work often arrives straight away, then sleep
+                uint64_t current = seen;
+                for (int64_t spin = 0; spin < spinIterations; ++spin) {
+                    current = ticket.load(std::memory_order_acquire);
+                    if (current != seen) break;
+                    backOff(spin);
+                }
+
+                if (current == seen) {
+                    std::unique_lock<std::mutex> lock(sleepMutex);
+                    wake.wait(lock, [&]() {
+                        return stop || ticket.load(std::memory_order_acquire) != seen;
+                    });
+                    if (stop) return;
+                    current = ticket.load(std::memory_order_acquire);
+                }
+
+                // Threads which are not taking part in a job never touch its state, so they can
+                // safely skip straight to a later job
+                seen = current;
+                if (id < (current & ((uint64_t(1) << ticketShift) - 1))) {
+                    execute(id);
+                    pending.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            }
+        }
+
+        /// Take the next chunk from a thread's own range
+        bool takeChunk(size_t id, int64_t &first, int64_t &last) {
+            WorkRange &range = ranges[id];
+            std::lock_guard<SpinLock> guard(range.lock);
+            if (range.next >= range.end) return false;
+            first      = range.next;
+            last       = std::min(range.end, first + chunk);
+            range.next = last;
+            return true;
+        }
+
+        /// Steal work from another thread. Half of the victim's remaining range is moved into
+        /// this thread's range, and the first chunk of it is returned.
+        bool steal(size_t id, int64_t &first, int64_t &last) {
+            for (size_t offset = 1; offset < participants; ++offset) {
+                WorkRange &victim = ranges[(id + offset) % participants];
+
+                int64_t stolenBegin, stolenEnd;
+                {
+                    std::lock_guard<SpinLock> guard(victim.lock);
+                    const int64_t remaining = victim.end - victim.next;
+                    if (remaining <= 0) continue;
+
+                    // Keep the split on a grain boundary
+                    const int64_t half = (remaining / 2 + grain - 1) / grain * grain;
+                    stolenBegin        = remaining > chunk ? victim.next + half : victim.next;
+                    stolenEnd          = victim.end;
+                    if (stolenBegin >= stolenEnd) continue;
+                    victim.end = stolenBegin;
+                }
+
+                first = stolenBegin;
+                last  = std::min(stolenEnd, first + chunk);
+
+                WorkRange &own = ranges[id];
+                std::lock_guard<SpinLock> guard(own.lock);
+                own.next = last;
+                own.end  = stolenEnd;
+                return true;
+            }
+            return false;
+        }
+
+        /// Process chunks until there is no work left anywhere
+        void execute(size_t id) {
+            int64_t first, last;
+            while (takeChunk(id, first, last) || steal(id, first, last)) {
+                try {
+                    (*body)(first, last);
+                } catch (...) {
+                    std::lock_guard<std::mutex> guard(errorMutex);
+                    if (!error) error = std::current_exception();
+                }
+            }
+        }
+    };
+
+    ThreadPool::ThreadPool() : m_impl(std::make_unique<Impl>()) {}
+
+    ThreadPool::~ThreadPool() = default;
+
+    ThreadPool &ThreadPool::instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    bool ThreadPool::inParallelRegion() { return inRegion; }
+
+    void ThreadPool::run(int64_t begin, int64_t end, int64_t grain, RangeFunctionRef body) {
+        if (end <= begin) return;
+        grain = std::max<int64_t>(grain, 1);
+
+        const int64_t iterations = end - begin;
+        const int64_t threads    = std::clamp<int64_t>(
+          static_cast<int64_t>(global::numThreads), 1, (int64_t(1) << ticketShift) - 1);
+
+        // Serial execution -- avoid oversubscription by running nested jobs on the calling
+        // thread
+        if (threads == 1 || iterations <= grain || inRegion) {
+            body(begin, end);
+            return;
+        }
+
+        // Jobs submitted from other threads wait for the current one to finish, rather than
+        // silently running on a single thread
+        std::unique_lock<std::mutex> lock(m_impl->submitMutex);
+
+        Impl &impl = *m_impl;
+        if (impl.workers.size() != size_t(threads - 1) || impl.pinned != global::pinThreads) {
+            impl.resize(size_t(threads - 1), global::pinThreads);
+        }
+
+        // Aim for a few chunks per thread, so there is something left to steal if the work is
+        // uneven
+        const int64_t grains      = (iterations + grain - 1) / grain;
+        const int64_t chunkGrains = std::max<int64_t>(1, grains / (threads * 4));
+        const int64_t chunks      = (grains + chunkGrains - 1) / chunkGrains;
+        impl.grain                = grain;
+        impl.chunk                = chunkGrains * grain;
+        impl.participants         = size_t(std::min(threads, chunks));
+        impl.body                 = &body;
+        impl.error                = nullptr;
+
+        // Give each thread an equal, contiguous share of the range. The shares depend only on
+        // the range, the grain and the number of threads, so loops over the same data give each
+        // thread (roughly) the same part of it. firstTouch relies on this.
+        const int64_t participants = int64_t(impl.participants);
+        for (int64_t id = 0; id < participants; ++id) {
+            impl.ranges[id].next = std::min(end, begin + grains * id / participants * grain);
+            impl.ranges[id].end  = std::min(end, begin + grains * (id + 1) / participants * grain);
+        }
+
+        impl.pending.store(int64_t(impl.participants) - 1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> guard(impl.sleepMutex);
+            const uint64_t job = (impl.ticket.load(std::memory_order_relaxed) >> ticketShift) + 1;
+            impl.ticket.store((job << ticketShift) | impl.participants, std::memory_order_release);
+        }
+        impl.wake.notify_all();
+
+        // The calling thread does its share of the work too
+        inRegion = true;
+        impl.execute(0);
+        inRegion = false;
+
+        for (int64_t spin = 0; impl.pending.load(std::memory_order_acquire) > 0; ++spin) {
+            backOff(spin);
+        }
+
+        if (impl.error) std::rethrow_exception(impl.error);
+    }
+
+    void firstTouch(void *data, size_t bytes) {
+        if (data == nullptr || global::numThreads <= 1 || ThreadPool::inParallelRegion()) return;
+
+        // Write one byte per page, so each page is mapped by the thread which will later
+        // process it. The memory is uninitialised, so the value written does not matter.
+        auto *bytePtr      = static_cast<volatile char *>(data);
+        const int64_t size = static_cast<int64_t>(bytes);
+        const auto stride  = static_cast<int64_t>(touchStride);
+        parallelFor(
+          0,
+          size,
+          [bytePtr, stride](int64_t first, int64_t last) {
+              for (int64_t offset = first; offset < last; offset += stride) {
+                  bytePtr[offset] = 0;
+              }
+          },
+          stride);
+    }
+} // namespace librapid::detail
@@ -203,17 +203,217 @@ using CUDA				   = lrc::backend::CUDA;
 	do {                                                                                           \
 	} while (false)
 
+#define TEST_ARITHMETIC_BROADCAST(SCALAR)                                                          \
+	SECTION(fmt::format("Test Array Broadcasting [{} | CPU]", STRINGIFY(SCALAR))) {                \
+		auto matrix = lrc::ordered<SCALAR, CPU>({37, 41});                                         \
+		auto row	= lrc::ordered<SCALAR, CPU>({41});                                             \
+		auto column = lrc::ordered<SCALAR, CPU>({37, 1});                                          \
+                                                                                                   \
+		auto rowResult = (matrix + row).eval();                                                    \
+		REQUIRE(rowResult.shape() == lrc::Shape({37, 41}));                                        \
+		auto columnResult = (matrix * column).eval();                                              \
+		REQUIRE(columnResult.shape() == lrc::Shape({37, 41}));                                     \
+		auto outerResult = (column - row).eval();                                                  \
+		REQUIRE(outerResult.shape() == lrc::Shape({37, 41}));                                      \
+                                                                                                   \
+		bool broadcastValid = true;                                                                \
+		for (int64_t i = 0; i < 37; ++i) {                                                         \
+			for (int64_t j = 0; j < 41; ++j) {                                                     \
+				const int64_t index = i * 41 + j;                                                  \
+				if (rowResult.scalar(index) != matrix.scalar(index) + row.scalar(j) ||             \
+					columnResult.scalar(index) != matrix.scalar(index) * column.scalar(i) ||       \
+					outerResult.scalar(index) != column.scalar(i) - row.scalar(j)) {               \
+					broadcastValid = false;                                                        \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(broadcastValid);                                                                   \
+                                                                                                   \
+		auto cube		= lrc::ordered<SCALAR, CPU>({3, 5, 7});                                    \
+		auto plane		= lrc::ordered<SCALAR, CPU>({5, 1});                                       \
+		auto cubeResult = (cube + plane).eval();                                                   \
+		REQUIRE(cubeResult.shape() == lrc::Shape({3, 5, 7}));                                      \
+		bool cubeValid = true;                                                                     \
+		for (int64_t i = 0; i < 3 * 5 * 7; ++i) {                                                  \
+			if (cubeResult.scalar(i) != cube.scalar(i) + plane.scalar((i / 7) % 5)) {              \
+				cubeValid = false;                                                                 \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(cubeValid);                                                                        \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_ARITHMETIC_FMA(SCALAR)                                                                \
+	SECTION(fmt::format("Test Array Multiply-Add [{} | CPU]", STRINGIFY(SCALAR))) {                \
+		auto a = lrc::ordered<SCALAR, CPU>({37, 41});                                              \
+		auto b = (lrc::ordered<SCALAR, CPU>({37, 41}) / SCALAR(7)).eval();                         \
+		auto c = (lrc::ordered<SCALAR, CPU>({37, 41}) * SCALAR(3)).eval();                         \
+		auto r = lrc::ordered<SCALAR, CPU>({41});                                                  \
+                                                                                                   \
+		auto fma       = (a * b + c).eval();                                                       \
+		auto fms       = (a * b - c).eval();                                                       \
+		auto fnma      = (c - a * b).eval();                                                       \
+		auto scalarA   = (a * SCALAR(2) + c).eval();                                               \
+		auto scalarB   = (SCALAR(3) + a * b).eval();                                               \
+		auto broadcast = (a * r + c).eval();                                                       \
+                                                                                                   \
+		bool fmaValid = true;                                                                      \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			const double ai = a.scalar(i), bi = b.scalar(i), ci = c.scalar(i);                     \
+			const double ri	 = r.scalar(i % 41);                                                   \
+			const double tol = tolerance * (1 + ai * bi + ci);                                     \
+			fmaValid &= lrc::isClose(double(fma.scalar(i)), ai * bi + ci, tol);                    \
+			fmaValid &= lrc::isClose(double(fms.scalar(i)), ai * bi - ci, tol);                    \
+			fmaValid &= lrc::isClose(double(fnma.scalar(i)), ci - ai * bi, tol);                   \
+			fmaValid &= lrc::isClose(double(scalarA.scalar(i)), ai * 2 + ci, tol);                 \
+			fmaValid &= lrc::isClose(double(scalarB.scalar(i)), 3 + ai * bi, tol);                 \
+			fmaValid &= lrc::isClose(double(broadcast.scalar(i)), ai * ri + ci, tol);              \
+		}                                                                                          \
+		REQUIRE(fmaValid);                                                                         \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_ARITHMETIC_TRANSPOSED(SCALAR)                                                         \
+	SECTION(fmt::format("Test Array Transposed Operands [{} | CPU]", STRINGIFY(SCALAR))) {         \
+		/* Large enough to be split into several tiles and evaluated in parallel */                \
+		auto a = lrc::ordered<SCALAR, CPU>({300, 211});                                            \
+		auto b = lrc::ordered<SCALAR, CPU>({211, 300});                                            \
+                                                                                                   \
+		auto sum = (a + lrc::transpose(b)).eval();                                                 \
+		REQUIRE(sum.shape() == lrc::Shape({300, 211}));                                            \
+                                                                                                   \
+		bool transposeValid = true;                                                                \
+		for (int64_t i = 0; i < 300; ++i) {                                                        \
+			for (int64_t j = 0; j < 211; ++j) {                                                    \
+				const SCALAR expected = a.scalar(i * 211 + j) + b.scalar(j * 300 + i);             \
+				transposeValid &= sum.scalar(i * 211 + j) == expected;                             \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(transposeValid);                                                                   \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_ARITHMETIC_MIXED(LHS_SCALAR, RHS_SCALAR)                                              \
+	SECTION(fmt::format(                                                                           \
+	  "Test Mixed Precision [{} | {} | CPU]", STRINGIFY(LHS_SCALAR), STRINGIFY(RHS_SCALAR))) {     \
+		using Result = decltype(LHS_SCALAR() + RHS_SCALAR());                                      \
+                                                                                                   \
+		auto a = lrc::ordered<LHS_SCALAR, CPU>({37, 41});                                          \
+		auto b = lrc::ordered<RHS_SCALAR, CPU>({37, 41});                                          \
+		auto r = lrc::ordered<RHS_SCALAR, CPU>({41});                                              \
+                                                                                                   \
+		auto sum       = (a + b).eval();                                                           \
+		auto prod      = (b * a).eval();                                                           \
+		auto scaled    = (a * RHS_SCALAR(3)).eval();                                               \
+		auto broadcast = (a - r).eval();                                                           \
+		static_assert(std::is_same_v<typename decltype(sum)::Scalar, Result>);                     \
+                                                                                                   \
+		bool mixedValid = true;                                                                    \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			const Result ai = a.scalar(i), bi = b.scalar(i), ri = r.scalar(i % 41);                \
+			mixedValid &= sum.scalar(i) == ai + bi;                                                \
+			mixedValid &= prod.scalar(i) == bi * ai;                                               \
+			mixedValid &= scaled.scalar(i) == ai * Result(3);                                      \
+			mixedValid &= broadcast.scalar(i) == ai - ri;                                          \
+		}                                                                                          \
+		REQUIRE(mixedValid);                                                                       \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_ARITHMETIC_STREAMING(SCALAR)                                                          \
+	SECTION(fmt::format("Test Array Streaming Stores [{} | CPU]", STRINGIFY(SCALAR))) {            \
+		/* Force streaming stores, for both the serial and parallel paths */                       \
+		lrc::global::ScopedSetting streaming(lrc::global::streamingStoreThreshold, size_t(0));     \
+                                                                                                   \
+		auto a     = lrc::ordered<SCALAR, CPU>({10007});                                           \
+		auto b     = lrc::ordered<SCALAR, CPU>({37});                                              \
+		auto large = (a + a * SCALAR(2)).eval();                                                   \
+		auto small = (b - SCALAR(1)).eval();                                                       \
+                                                                                                   \
+		bool streamingValid = true;                                                                \
+		for (int64_t i = 0; i < 10007; ++i) {                                                      \
+			streamingValid &= large.scalar(i) == a.scalar(i) + a.scalar(i) * SCALAR(2);            \
+		}                                                                                          \
+		for (int64_t i = 0; i < 37; ++i) {                                                         \
+			streamingValid &= small.scalar(i) == b.scalar(i) - SCALAR(1);                          \
+		}                                                                                          \
+		REQUIRE(streamingValid);                                                                   \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_ARITHMETIC_SHARED(SCALAR)                                                             \
+	SECTION(fmt::format("Test Array Shared Destination [{} | CPU]", STRINGIFY(SCALAR))) {          \
+		auto a = lrc::ordered<SCALAR, CPU>({1000});                                                \
+                                                                                                   \
+		/* The copy shares the elements of a, which are not needed for the result */               \
+		lrc::Array<SCALAR, CPU> b = a;                                                             \
+		b						  = a + SCALAR(1);                                                 \
+                                                                                                   \
+		/* Here, the shared elements are an operand, so they must be kept */                       \
+		lrc::Array<SCALAR, CPU> c = a;                                                             \
+		c						  = c * SCALAR(2);                                                 \
+                                                                                                   \
+		bool sharedValid = true;                                                                   \
+		for (int64_t i = 0; i < 1000; ++i) {                                                       \
+			sharedValid &= a.scalar(i) == SCALAR(i);                                               \
+			sharedValid &= b.scalar(i) == SCALAR(i) + SCALAR(1);                                   \
+			sharedValid &= c.scalar(i) == SCALAR(i) * SCALAR(2);                                   \
+		}                                                                                          \
+		REQUIRE(sharedValid);                                                                      \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
 #define TEST_ALL(SCALAR, BACKEND)                                                                  \
 	TEST_ARITHMETIC(SCALAR, BACKEND);                                                              \
 	TEST_ARITHMETIC_ARRAY_SCALAR(SCALAR, BACKEND);                                                 \
 	TEST_ARITHMETIC_SCALAR_ARRAY(SCALAR, BACKEND);
 
-TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") { TEST_ALL(int32_t, CPU); }
-TEST_CASE("Test Array -- uint32_t CPU", "[array-lib]") { TEST_ALL(uint32_t, CPU); }
-TEST_CASE("Test Array -- int64_t CPU", "[array-lib]") { TEST_ALL(int64_t, CPU); }
-TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") { TEST_ALL(uint64_t, CPU); }
-TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_ALL(float, CPU); }
-TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_ALL(double, CPU); }
+TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") {
+	TEST_ALL(int32_t, CPU);
+	TEST_ARITHMETIC_BROADCAST(int32_t);
+	TEST_ARITHMETIC_STREAMING(int32_t);
+	TEST_ARITHMETIC_SHARED(int32_t);
+}
+TEST_CASE("Test Array -- uint32_t CPU", "[array-lib]") {
+	TEST_ALL(uint32_t, CPU);
+	TEST_ARITHMETIC_BROADCAST(uint32_t);
+}
+TEST_CASE("Test Array -- int64_t CPU", "[array-lib]") {
+	TEST_ALL(int64_t, CPU);
+	TEST_ARITHMETIC_BROADCAST(int64_t);
+}
+TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") {
+	TEST_ALL(uint64_t, CPU);
+	TEST_ARITHMETIC_BROADCAST(uint64_t);
+}
+TEST_CASE("Test Array -- float CPU", "[array-lib]") {
+	TEST_ALL(float, CPU);
+	TEST_ARITHMETIC_BROADCAST(float);
+	TEST_ARITHMETIC_STREAMING(float);
+	TEST_ARITHMETIC_SHARED(float);
+	TEST_ARITHMETIC_FMA(float);
+	TEST_ARITHMETIC_TRANSPOSED(float);
+}
+TEST_CASE("Test Array -- double CPU", "[array-lib]") {
+	TEST_ALL(double, CPU);
+	TEST_ARITHMETIC_BROADCAST(double);
+	TEST_ARITHMETIC_STREAMING(double);
+	TEST_ARITHMETIC_SHARED(double);
+	TEST_ARITHMETIC_FMA(double);
+	TEST_ARITHMETIC_TRANSPOSED(double);
+}
+TEST_CASE("Test Array -- mixed precision CPU", "[array-lib]") {
+	TEST_ARITHMETIC_MIXED(float, double);
+	TEST_ARITHMETIC_MIXED(int32_t, float);
+	TEST_ARITHMETIC_MIXED(int32_t, double);
+	TEST_ARITHMETIC_MIXED(int16_t, float);
+}
 
 #if defined(LIBRAPID_USE_MULTIPREC)
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_ALL(lrc::mpfr, CPU); }
@@ -241,17 +241,59 @@ using CUDA				   = lrc::backend::CUDA;
 	do {                                                                                           \
 	} while (false)
 
+#define TEST_WHERE(SCALAR)                                                                         \
+	SECTION(fmt::format("Test Array Where [{} | CPU]", STRINGIFY(SCALAR))) {                       \
+		auto a   = lrc::ordered<SCALAR, CPU>({53, 79});                                            \
+		auto b   = (SCALAR(53 * 79) - a).eval();                                                   \
+		auto row = lrc::ordered<SCALAR, CPU>({79});                                                \
+                                                                                                   \
+		auto minimum = lrc::where(a < b, a, b).eval();                                             \
+		auto clipped = lrc::where(a > SCALAR(2000), SCALAR(2000), a).eval();                       \
+		auto rows    = lrc::where(row >= SCALAR(40), a, b).eval();                                 \
+		auto values  = lrc::where(a - row, a, SCALAR(7)).eval();                                   \
+                                                                                                   \
+		bool whereValid = true;                                                                    \
+		for (int64_t i = 0; i < 53 * 79; ++i) {                                                    \
+			const SCALAR ai = a.scalar(i), bi = b.scalar(i), ri = row.scalar(i % 79);              \
+			whereValid &= minimum.scalar(i) == (ai < bi ? ai : bi);                                \
+			whereValid &= clipped.scalar(i) == (ai > SCALAR(2000) ? SCALAR(2000) : ai);            \
+			whereValid &= rows.scalar(i) == (ri >= SCALAR(40) ? ai : bi);                          \
+			whereValid &= values.scalar(i) == (ai - ri != SCALAR(0) ? ai : SCALAR(7));             \
+		}                                                                                          \
+		REQUIRE(whereValid);                                                                       \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
 #define TEST_ALL(SCALAR, BACKEND)                                                                  \
 	TEST_COMPARISONS(SCALAR, BACKEND);                                                             \
 	TEST_COMPARISONS_ARRAY_SCALAR(SCALAR, BACKEND);                                                \
 	TEST_COMPARISONS_SCALAR_ARRAY(SCALAR, BACKEND);
 
-TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") { TEST_ALL(int32_t, CPU); }
-TEST_CASE("Test Array -- uint32_t CPU", "[array-lib]") { TEST_ALL(uint32_t, CPU); }
-TEST_CASE("Test Array -- int64_t CPU", "[array-lib]") { TEST_ALL(int64_t, CPU); }
-TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") { TEST_ALL(uint64_t, CPU); }
-TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_ALL(float, CPU); }
-TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_ALL(double, CPU); }
+TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") {
+	TEST_ALL(int32_t, CPU);
+	TEST_WHERE(int32_t);
+}
+TEST_CASE("Test Array -- uint32_t CPU", "[array-lib]") {
+	TEST_ALL(uint32_t, CPU);
+	TEST_WHERE(uint32_t);
+}
+TEST_CASE("Test Array -- int64_t CPU", "[array-lib]") {
+	TEST_ALL(int64_t, CPU);
+	TEST_WHERE(int64_t);
+}
+TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") {
+	TEST_ALL(uint64_t, CPU);
+	TEST_WHERE(uint64_t);
+}
+TEST_CASE("Test Array -- float CPU", "[array-lib]") {
+	TEST_ALL(float, CPU);
+	TEST_WHERE(float);
+}
+TEST_CASE("Test Array -- double CPU", "[array-lib]") {
+	TEST_ALL(double, CPU);
+	TEST_WHERE(double);
+}
 
 #if defined(LIBRAPID_USE_MULTIPREC)
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_ALL(lrc::mpfr, CPU); }
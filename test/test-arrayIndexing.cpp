@@ -58,6 +58,43 @@ TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") { TEST_INDEXING(uint64_t,
 TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_INDEXING(float, CPU); }
 TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_INDEXING(double, CPU); }
 
+TEST_CASE("Test Array -- row views", "[array-lib]") {
+	lrc::Array<float, CPU> a(lrc::Array<float, CPU>::ShapeType({3, 4}));
+	lrc::Array<float, CPU> b(lrc::Array<float, CPU>::ShapeType({3, 4}));
+	a << 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12;
+	b << 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1;
+
+	// Assigning to a row writes directly into the parent array
+	a[1] = b[1] * 2;
+	for (int64_t i = 0; i < 4; ++i) {
+		REQUIRE(a.scalar(i) == float(i + 1));
+		REQUIRE(a.scalar(4 + i) == b.scalar(4 + i) * 2);
+		REQUIRE(a.scalar(8 + i) == float(i + 9));
+	}
+
+	// A row held by value still refers to the parent array
+	auto row = a[2];
+	REQUIRE(row.shape().ndim() == 1);
+	REQUIRE(row.shape()[0] == 4);
+	row = b[2] + b[2];
+	REQUIRE(a.scalar(8) == 8);
+	REQUIRE(a.scalar(11) == 2);
+
+	// Copies of a row are views too
+	auto copy = row;
+	copy	  = b[0] * 0;
+	REQUIRE(a.scalar(8) == 0);
+	REQUIRE(a.scalar(11) == 0);
+	REQUIRE(a.scalar(4) == b.scalar(4) * 2);
+
+	// Assigning a row to an array copies it
+	lrc::Array<float, CPU> c;
+	c = a[0];
+	c = c + 1;
+	REQUIRE(c.scalar(0) == 2);
+	REQUIRE(a.scalar(0) == 1);
+}
+
 #if defined(LIBRAPID_USE_MULTIPREC)
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_INDEXING(lrc::mpfr, CPU); }
 #endif // LIBRAPID_USE_MULTIPREC
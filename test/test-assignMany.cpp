@@ -0,0 +1,56 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc			   = librapid;
+constexpr double tolerance = 0.001;
+using CPU				   = lrc::backend::CPU;
+
+#define TEST_ASSIGN_MANY(SCALAR)                                                                   \
+	TEST_CASE(fmt::format("Test assignMany -- {}", STRINGIFY(SCALAR)), "[array-lib]") {            \
+		SECTION("Matching shapes") {                                                               \
+			auto x = lrc::ordered<SCALAR, CPU>({37, 41});                                          \
+			auto y = lrc::Array<SCALAR, CPU>(lrc::Shape({37, 41}));                                \
+			auto z = lrc::Array<SCALAR, CPU>(lrc::Shape({37, 41}));                                \
+                                                                                                   \
+			lrc::assignMany(std::tie(y, z), x + x, x * x - SCALAR(1));                             \
+			for (int64_t i = 0; i < 37 * 41; ++i) {                                                \
+				REQUIRE(y.scalar(i) == x.scalar(i) + x.scalar(i));                                 \
+				REQUIRE(z.scalar(i) == x.scalar(i) * x.scalar(i) - SCALAR(1));                     \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		SECTION("Large arrays") {                                                                  \
+			/* Large enough to use the parallel path, and not a multiple of the packet width */    \
+			auto x = lrc::ordered<SCALAR, CPU>({10007}) / SCALAR(100);                             \
+			auto a = lrc::Array<SCALAR, CPU>(lrc::Shape({10007}));                                 \
+			auto b = lrc::Array<SCALAR, CPU>(lrc::Shape({10007}));                                 \
+			auto c = lrc::Array<SCALAR, CPU>(lrc::Shape({10007}));                                 \
+                                                                                                   \
+			auto x2 = x.eval();                                                                    \
+			lrc::assignMany(std::tie(a, b, c), x2 * SCALAR(2), x2 - SCALAR(3), x2);                \
+			for (int64_t i = 0; i < 10007; ++i) {                                                  \
+				REQUIRE(lrc::isClose(a.scalar(i), x2.scalar(i) * SCALAR(2), tolerance));           \
+				REQUIRE(lrc::isClose(b.scalar(i), x2.scalar(i) - SCALAR(3), tolerance));           \
+				REQUIRE(c.scalar(i) == x2.scalar(i));                                              \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		SECTION("Destination used as an operand") {                                                \
+			auto x	  = lrc::ordered<SCALAR, CPU>({37, 41});                                       \
+			auto y	  = lrc::Array<SCALAR, CPU>(lrc::Shape({37, 41}));                             \
+			auto copy = x.copy();                                                                  \
+                                                                                                   \
+			/* Both expressions must see the original values of x */                               \
+			lrc::assignMany(std::tie(x, y), x + SCALAR(1), x * SCALAR(2));                         \
+			for (int64_t i = 0; i < 37 * 41; ++i) {                                                \
+				REQUIRE(x.scalar(i) == copy.scalar(i) + SCALAR(1));                                \
+				REQUIRE(y.scalar(i) == copy.scalar(i) * SCALAR(2));                                \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_ASSIGN_MANY(float)
+TEST_ASSIGN_MANY(double)
+TEST_ASSIGN_MANY(int32_t)
@@ -0,0 +1,67 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace lrc = librapid;
+using CPU	  = lrc::backend::CPU;
+
+TEST_CASE("Test multithreading threshold calibration", "[calibration]") {
+	const auto cacheFile = std::filesystem::temp_directory_path() / "librapid-test-thresholds.txt";
+	lrc::global::ScopedSetting file(lrc::global::calibrationCacheFile, cacheFile.string());
+	lrc::global::ScopedSetting calibrate(lrc::global::calibrateThresholds, true);
+	lrc::global::ScopedSetting threads(lrc::global::numThreads, lrc::global::numThreads);
+	lrc::resetCalibration();
+
+	auto a = lrc::ordered<float, CPU>({100000});
+	auto b = lrc::ones<float, CPU>({100000});
+
+	SECTION("Thresholds are measured and cached") {
+		auto cheap		 = a + b;
+		auto expensive	 = lrc::exp(lrc::sin(a) * lrc::cos(b));
+		const size_t sum = lrc::detail::parallelThreshold(cheap);
+		const size_t exp = lrc::detail::parallelThreshold(expensive);
+
+		// The expensive expression needs fewer elements to make parallel evaluation worthwhile.
+		// Both thresholds may be clamped to the smallest allowed value on a machine with a very
+		// cheap thread pool.
+		if (std::thread::hardware_concurrency() > 1 && lrc::global::numThreads > 1) {
+			REQUIRE(exp <= sum);
+			if (sum > 1024) REQUIRE(exp < sum);
+		} else {
+			REQUIRE(exp == sum);
+		}
+
+		// The result is remembered, and saved to the cache file
+		REQUIRE(lrc::detail::parallelThreshold(cheap) == sum);
+		REQUIRE(lrc::detail::calibration::lookup(typeid(cheap).name()) == sum);
+		REQUIRE(std::filesystem::exists(cacheFile));
+
+		// Evaluating the expressions gives the same result either way
+		lrc::Array<float, CPU> result = cheap;
+		for (int64_t i = 0; i < 100000; ++i) REQUIRE(result.scalar(i) == float(i) + 1.0f);
+	}
+
+	SECTION("Changing the number of threads invalidates the thresholds") {
+		auto cheap = a + b;
+		(void)lrc::detail::parallelThreshold(cheap);
+		REQUIRE(lrc::detail::calibration::lookup(typeid(cheap).name()) > 0);
+
+		lrc::global::ScopedSetting moreThreads(lrc::global::numThreads,
+											   lrc::global::numThreads + 1);
+		REQUIRE(lrc::detail::calibration::lookup(typeid(cheap).name()) == 0);
+		REQUIRE(lrc::detail::parallelThreshold(cheap) >= 1024);
+	}
+
+	SECTION("Calibration can be disabled") {
+		lrc::global::ScopedSetting disable(lrc::global::calibrateThresholds, false);
+		REQUIRE(lrc::detail::parallelThreshold(a * b) == lrc::global::multithreadThreshold);
+	}
+
+	// Delete the test's cache file before the previous settings are restored
+	lrc::resetCalibration();
+}
@@ -76,6 +76,113 @@ constexpr double tolerance = 0.001;
 		}                                                                                          \
 	}
 
+#define TEST_ARRAY_VIEW_EVALUATION(SCALAR)                                                         \
+	TEST_CASE(fmt::format("Test GeneralArrayView Evaluation -- {}", STRINGIFY(SCALAR)),            \
+			  "[array-lib]") {                                                                     \
+		/* Dimensions are not multiples of the packet width, so packets straddle rows */           \
+		auto cube = lrc::ordered<SCALAR, lrc::backend::CPU>({5, 13, 17});                          \
+		auto rows = cube[2];                                                                       \
+                                                                                                   \
+		auto rowsEval = rows.eval();                                                               \
+		auto rowsSum  = (rows + rows).eval();                                                      \
+		REQUIRE(rowsSum.shape() == lrc::Shape({13, 17}));                                          \
+		for (int64_t i = 0; i < 13 * 17; ++i) {                                                    \
+			REQUIRE(rowsEval.scalar(i) == cube.scalar(2 * 13 * 17 + i));                           \
+			REQUIRE(rowsSum.scalar(i) == SCALAR(2) * cube.scalar(2 * 13 * 17 + i));                \
+		}                                                                                          \
+                                                                                                   \
+		/* Stride's constructor computes contiguous strides, so the values are set afterwards */   \
+		auto makeStride = [](std::initializer_list<int64_t> values) {                              \
+			lrc::Stride<lrc::Shape> stride(lrc::Shape(values));                                    \
+			int64_t dim = 0;                                                                       \
+			for (int64_t value : values) stride[dim++] = value;                                    \
+			return stride;                                                                         \
+		};                                                                                         \
+                                                                                                   \
+		/* A strided column of a matrix */                                                         \
+		auto matrix = lrc::ordered<SCALAR, lrc::backend::CPU>({37, 41});                           \
+		auto column = lrc::createGeneralArrayView(matrix);                                         \
+		column.setShape(lrc::Shape({37}));                                                         \
+		column.setStride(makeStride({41}));                                                        \
+		column.setOffset(3);                                                                       \
+                                                                                                   \
+		auto columnEval	   = column.eval();                                                        \
+		auto columnProduct = (column * SCALAR(2)).eval();                                          \
+		lrc::Array<SCALAR, lrc::backend::CPU> columnCopy;                                          \
+		columnCopy = column;                                                                       \
+		for (int64_t i = 0; i < 37; ++i) {                                                         \
+			REQUIRE(columnEval.scalar(i) == matrix.scalar(i * 41 + 3));                            \
+			REQUIRE(columnCopy.scalar(i) == matrix.scalar(i * 41 + 3));                            \
+			REQUIRE(columnProduct.scalar(i) == SCALAR(2) * matrix.scalar(i * 41 + 3));             \
+		}                                                                                          \
+                                                                                                   \
+		/* Copy a block of one matrix into another, and one column into another */                 \
+		auto target		= lrc::zeros<SCALAR, lrc::backend::CPU>({37, 41});                         \
+		auto sourceView = lrc::createGeneralArrayView(matrix);                                     \
+		auto targetView = lrc::createGeneralArrayView(target);                                     \
+		sourceView.setShape(lrc::Shape({4, 9}));                                                   \
+		targetView.setShape(lrc::Shape({4, 9}));                                                   \
+		sourceView.setStride(makeStride({41, 1}));                                                 \
+		targetView.setStride(makeStride({41, 1}));                                                 \
+		sourceView.setOffset(2 * 41 + 5);                                                          \
+		targetView.setOffset(10 * 41 + 20);                                                        \
+		targetView = sourceView;                                                                   \
+		for (int64_t row = 0; row < 4; ++row) {                                                    \
+			for (int64_t col = 0; col < 9; ++col) {                                                \
+				REQUIRE(target.scalar((10 + row) * 41 + 20 + col) ==                               \
+						matrix.scalar((2 + row) * 41 + 5 + col));                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(target.scalar(10 * 41 + 19) == SCALAR(0));                                         \
+		REQUIRE(target.scalar(10 * 41 + 29) == SCALAR(0));                                         \
+                                                                                                   \
+		/* Reading through a view does not separate the source from its copies */                  \
+		auto matrixCopy = matrix;                                                                  \
+		targetView		= sourceView;                                                              \
+		REQUIRE(matrix.storage().isShared());                                                      \
+		REQUIRE(matrixCopy.storage().isShared());                                                  \
+                                                                                                   \
+		auto targetColumn = lrc::createGeneralArrayView(target);                                   \
+		targetColumn.setShape(lrc::Shape({37}));                                                   \
+		targetColumn.setStride(makeStride({41}));                                                  \
+		targetColumn.setOffset(40);                                                                \
+		targetColumn = column;                                                                     \
+		for (int64_t i = 0; i < 37; ++i) {                                                         \
+			REQUIRE(target.scalar(i * 41 + 40) == matrix.scalar(i * 41 + 3));                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Shift a block and a column of an array down by one row, within the array itself */      \
+		auto shifted	   = lrc::ordered<SCALAR, lrc::backend::CPU>({37, 41});                    \
+		auto blockFrom = lrc::createGeneralArrayView(shifted);                                     \
+		auto blockTo   = lrc::createGeneralArrayView(shifted);                                     \
+		blockFrom.setShape(lrc::Shape({4, 9}));                                                    \
+		blockTo.setShape(lrc::Shape({4, 9}));                                                      \
+		blockFrom.setStride(makeStride({41, 1}));                                                  \
+		blockTo.setStride(makeStride({41, 1}));                                                    \
+		blockFrom.setOffset(2 * 41 + 5);                                                           \
+		blockTo.setOffset(3 * 41 + 5);                                                             \
+		blockTo = blockFrom;                                                                       \
+		for (int64_t row = 0; row < 4; ++row) {                                                    \
+			for (int64_t col = 0; col < 9; ++col) {                                                \
+				REQUIRE(shifted.scalar((3 + row) * 41 + 5 + col) ==                                \
+						matrix.scalar((2 + row) * 41 + 5 + col));                                  \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		auto columnFrom = lrc::createGeneralArrayView(shifted);                                    \
+		auto columnTo	= lrc::createGeneralArrayView(shifted);                                    \
+		columnFrom.setShape(lrc::Shape({36}));                                                     \
+		columnTo.setShape(lrc::Shape({36}));                                                       \
+		columnFrom.setStride(makeStride({41}));                                                    \
+		columnTo.setStride(makeStride({41}));                                                      \
+		columnFrom.setOffset(30);                                                                  \
+		columnTo.setOffset(41 + 30);                                                               \
+		columnTo = columnFrom;                                                                     \
+		for (int64_t i = 0; i < 36; ++i) {                                                         \
+			REQUIRE(shifted.scalar((i + 1) * 41 + 30) == matrix.scalar(i * 41 + 30));              \
+		}                                                                                          \
+	}
+
 // TEST_ARRAY_VIEW(int8_t, lrc::backend::CPU)
 TEST_ARRAY_VIEW(int16_t, lrc::backend::CPU)
 TEST_ARRAY_VIEW(int32_t, lrc::backend::CPU)
@@ -83,6 +190,10 @@ TEST_ARRAY_VIEW(int64_t, lrc::backend::CPU)
 TEST_ARRAY_VIEW(float, lrc::backend::CPU)
 TEST_ARRAY_VIEW(double, lrc::backend::CPU)
 
+TEST_ARRAY_VIEW_EVALUATION(int32_t)
+TEST_ARRAY_VIEW_EVALUATION(float)
+TEST_ARRAY_VIEW_EVALUATION(double)
+
 #if defined(LIBRAPID_HAS_OPENCL)
 TEST_CASE("Configure OpenCL", "[array-lib]") { lrc::configureOpenCL(true); }
 
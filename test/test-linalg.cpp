@@ -0,0 +1,445 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+using CPU	  = lrc::backend::CPU;
+
+// Fill an array with small integers, so every product is exact
+template<typename ArrayType>
+void fillTestValues(ArrayType &array, int64_t seed) {
+	using Scalar = typename lrc::typetraits::TypeInfo<ArrayType>::Scalar;
+	for (int64_t i = 0; i < int64_t(array.size()); ++i) {
+		array.storage()[i] = static_cast<Scalar>((i * 7 + seed) % 5 - 2);
+	}
+}
+
+template<typename Scalar>
+auto testVector(int64_t elements, int64_t seed) {
+	lrc::Array<Scalar, CPU> res(lrc::Shape({elements}));
+	fillTestValues(res, seed);
+	return res;
+}
+
+template<typename Scalar>
+auto testMatrix(int64_t rows, int64_t cols, int64_t seed) {
+	lrc::Array<Scalar, CPU> res(lrc::Shape({rows, cols}));
+	fillTestValues(res, seed);
+	return res;
+}
+
+// A stack of matrices. A batch of zero gives a single 2-D matrix.
+template<typename Scalar>
+auto testBatch(int64_t batch, int64_t rows, int64_t cols, int64_t seed) {
+	if (batch == 0) return testMatrix<Scalar>(rows, cols, seed);
+	lrc::Array<Scalar, CPU> res(lrc::Shape({batch, rows, cols}));
+	fillTestValues(res, seed);
+	return res;
+}
+
+template<typename Scalar, size_t Rows, size_t Cols>
+auto testFixedMatrix(int64_t seed) {
+	lrc::MatrixF<Scalar, Rows, Cols> res(Scalar(0));
+	fillTestValues(res, seed);
+	return res;
+}
+
+template<typename Scalar, size_t Elements>
+auto testFixedVector(int64_t seed) {
+	lrc::ArrayF<Scalar, Elements> res(Scalar(0));
+	fillTestValues(res, seed);
+	return res;
+}
+
+// A unit upper-triangular matrix with its rows reversed. Its inverse has integer elements, so
+// it is computed exactly, but every column needs a row swap.
+template<typename Scalar, size_t N>
+auto testInvertible() {
+	lrc::MatrixF<Scalar, N, N> res(Scalar(0));
+	for (int64_t i = 0; i < int64_t(N); ++i) {
+		for (int64_t j = i; j < int64_t(N); ++j) {
+			const int64_t row = int64_t(N) - 1 - i;
+			res.storage()[row * N + j] = i == j ? Scalar(1) : static_cast<Scalar>((i + j) % 3 - 1);
+		}
+	}
+	return res;
+}
+
+// An epilogue with a packet form, which counts the packets it is given. Both forms compute
+// 2 * value + col % 5
+template<typename Scalar>
+struct PacketEpilogue {
+	std::atomic<int64_t> *packets;
+
+	Scalar operator()(Scalar value, int64_t, int64_t col) const {
+		return value * Scalar(2) + static_cast<Scalar>(col % 5);
+	}
+
+	template<typename Packet>
+	Packet packet(const Packet &value, int64_t, int64_t col) const {
+		alignas(LIBRAPID_MEM_ALIGN) Scalar offsets[Packet::size];
+		for (int64_t lane = 0; lane < int64_t(Packet::size); ++lane) {
+			offsets[lane] = static_cast<Scalar>((col + lane) % 5);
+		}
+		++*packets;
+		return value * Packet(Scalar(2)) + Packet::load_aligned(offsets);
+	}
+};
+
+#define TEST_GEMM(SCALAR)                                                                          \
+	TEST_CASE(fmt::format("Test GEMM -- {}", STRINGIFY(SCALAR)), "[linalg]") {                     \
+		/* Sizes which are not multiples of the micro-kernel's tile, and a deep inner dimension */ \
+		auto [m, n, k] = GENERATE(std::make_tuple(1, 1, 1),                                        \
+								  std::make_tuple(7, 13, 5),                                       \
+								  std::make_tuple(64, 64, 64),                                     \
+								  std::make_tuple(130, 70, 300),                                   \
+								  std::make_tuple(5, 600, 9));                                     \
+                                                                                                   \
+		auto a = testMatrix<SCALAR>(m, k, 1);                                                      \
+		auto b = testMatrix<SCALAR>(k, n, 2);                                                      \
+		auto expected = [&](int64_t i, int64_t j) {                                                \
+			SCALAR sum(0);                                                                         \
+			for (int64_t p = 0; p < k; ++p) sum += a.scalar(i * k + p) * b.scalar(p * n + j);      \
+			return sum;                                                                            \
+		};                                                                                         \
+                                                                                                   \
+		/* Transposed operands are passed to GEMM with the transpose flags set */                  \
+		auto aT = lrc::transpose(a).eval();                                                        \
+		auto bT = lrc::transpose(b).eval();                                                        \
+		auto c	= lrc::dot(a, b).eval();                                                           \
+		auto cT = lrc::dot(lrc::transpose(aT), lrc::transpose(bT)).eval();                         \
+		REQUIRE(c.shape() == lrc::Shape({m, n}));                                                  \
+		REQUIRE(cT.shape() == lrc::Shape({m, n}));                                                 \
+		for (int64_t i = 0; i < m; ++i) {                                                          \
+			for (int64_t j = 0; j < n; ++j) {                                                      \
+				REQUIRE(c.scalar(i * n + j) == expected(i, j));                                    \
+				REQUIRE(cT.scalar(i * n + j) == expected(i, j));                                   \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_GEMM(int32_t)
+TEST_GEMM(int64_t)
+TEST_GEMM(float)
+TEST_GEMM(double)
+
+// int8_t and half always use the packed kernel, and Complex uses it when BLAS is unavailable.
+// The elements and sums are small integers, so they are exact in half precision, and int8_t
+// wraps in the same way in the reference and in the kernel.
+TEST_GEMM(int8_t)
+TEST_GEMM(lrc::half)
+TEST_GEMM(lrc::Complex<float>)
+TEST_GEMM(lrc::Complex<double>)
+
+#define TEST_BATCHED_GEMM(SCALAR)                                                                  \
+	TEST_CASE(fmt::format("Test batched GEMM -- {}", STRINGIFY(SCALAR)), "[linalg]") {             \
+		/* A batch of zero means that operand is a single matrix, shared by the whole batch */     \
+		auto [batchA, batchB, m, n, k] = GENERATE(std::make_tuple(4, 4, 7, 13, 5),                 \
+												  std::make_tuple(1, 1, 3, 2, 4),                  \
+												  std::make_tuple(3, 3, 20, 130, 17),              \
+												  std::make_tuple(5, 0, 9, 11, 6),                 \
+												  std::make_tuple(0, 6, 9, 11, 6));                \
+		const int64_t batch = std::max(batchA, batchB);                                            \
+                                                                                                   \
+		auto a		  = testBatch<SCALAR>(batchA, m, k, 1);                                        \
+		auto b		  = testBatch<SCALAR>(batchB, k, n, 2);                                        \
+		auto expected = [&](int64_t z, int64_t i, int64_t j) {                                     \
+			const int64_t offsetA = batchA == 0 ? 0 : z * m * k;                                   \
+			const int64_t offsetB = batchB == 0 ? 0 : z * k * n;                                   \
+			SCALAR sum			  = 0;                                                             \
+			for (int64_t p = 0; p < k; ++p) {                                                      \
+				sum += a.scalar(offsetA + i * k + p) * b.scalar(offsetB + p * n + j);              \
+			}                                                                                      \
+			return sum;                                                                            \
+		};                                                                                         \
+                                                                                                   \
+		auto c = lrc::dot(a, b).eval();                                                            \
+		REQUIRE(c.shape() == lrc::Shape({batch, m, n}));                                           \
+		for (int64_t z = 0; z < batch; ++z) {                                                      \
+			for (int64_t i = 0; i < m; ++i) {                                                      \
+				for (int64_t j = 0; j < n; ++j) {                                                  \
+					REQUIRE(c.scalar((z * m + i) * n + j) == expected(z, i, j));                   \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Swapping the last two axes of each operand sets the transpose flags */                  \
+		auto swapInner = [](const lrc::Array<SCALAR, CPU> &x) {                                    \
+			auto shape			= x.shape();                                                       \
+			const int64_t dims	= shape.ndim();                                                    \
+			const int64_t rows	= shape[dims - 2], cols = shape[dims - 1];                         \
+			const int64_t count	= dims == 3 ? shape[0] : 1;                                        \
+			shape[dims - 2]	= cols;                                                                \
+			shape[dims - 1]	= rows;                                                                \
+			lrc::Array<SCALAR, CPU> res(shape);                                                    \
+			for (int64_t z = 0; z < count; ++z) {                                                  \
+				for (int64_t i = 0; i < rows; ++i) {                                               \
+					for (int64_t j = 0; j < cols; ++j) {                                           \
+						res.storage()[(z * cols + j) * rows + i] =                                 \
+						  x.scalar((z * rows + i) * cols + j);                                     \
+					}                                                                              \
+				}                                                                                  \
+			}                                                                                      \
+			return res;                                                                            \
+		};                                                                                         \
+		auto innerAxes = [](const lrc::Array<SCALAR, CPU> &x) {                                    \
+			return x.ndim() == 3 ? lrc::Shape({0, 2, 1}) : lrc::Shape({1, 0});                     \
+		};                                                                                         \
+                                                                                                   \
+		auto aT = swapInner(a);                                                                    \
+		auto bT = swapInner(b);                                                                    \
+		auto cT =                                                                                  \
+		  lrc::dot(lrc::transpose(aT, innerAxes(aT)), lrc::transpose(bT, innerAxes(bT)))           \
+			.eval();                                                                               \
+		REQUIRE(cT.shape() == lrc::Shape({batch, m, n}));                                          \
+		for (int64_t z = 0; z < batch; ++z) {                                                      \
+			for (int64_t i = 0; i < m; ++i) {                                                      \
+				for (int64_t j = 0; j < n; ++j) {                                                  \
+					REQUIRE(cT.scalar((z * m + i) * n + j) == expected(z, i, j));                  \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Any other permutation is evaluated before the product */                                \
+		if (batchA != 0) {                                                                         \
+			lrc::Array<SCALAR, CPU> aPerm(lrc::Shape({m, batchA, k}));                             \
+			for (int64_t z = 0; z < batchA; ++z) {                                                 \
+				for (int64_t i = 0; i < m; ++i) {                                                  \
+					for (int64_t p = 0; p < k; ++p) {                                              \
+						aPerm.storage()[(i * batchA + z) * k + p] = a.scalar((z * m + i) * k + p); \
+					}                                                                              \
+				}                                                                                  \
+			}                                                                                      \
+                                                                                                   \
+			auto cPerm = lrc::dot(lrc::transpose(aPerm, lrc::Shape({1, 0, 2})), b).eval();         \
+			REQUIRE(cPerm.shape() == lrc::Shape({batch, m, n}));                                   \
+			for (int64_t z = 0; z < batch; ++z) {                                                  \
+				for (int64_t i = 0; i < m; ++i) {                                                  \
+					for (int64_t j = 0; j < n; ++j) {                                              \
+						REQUIRE(cPerm.scalar((z * m + i) * n + j) == expected(z, i, j));           \
+					}                                                                              \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_BATCHED_GEMM(int32_t)
+TEST_BATCHED_GEMM(float)
+TEST_BATCHED_GEMM(double)
+
+#define TEST_DOT_AND_OUTER(SCALAR)                                                                 \
+	TEST_CASE(fmt::format("Test DOT -- {}", STRINGIFY(SCALAR)), "[linalg]") {                      \
+		/* Long vectors are split between threads */                                               \
+		auto n = GENERATE(1, 7, 33, 1000, 100003);                                                 \
+                                                                                                   \
+		auto a			= testVector<SCALAR>(n, 1);                                                \
+		auto b			= testVector<SCALAR>(n, 2);                                                \
+		SCALAR expected = 0;                                                                       \
+		for (int64_t i = 0; i < n; ++i) expected += a.scalar(i) * b.scalar(i);                     \
+                                                                                                   \
+		auto c = lrc::dot(a, b).eval();                                                            \
+		REQUIRE(c.shape() == lrc::Shape({1}));                                                     \
+		REQUIRE(c.scalar(0) == expected);                                                          \
+	}                                                                                              \
+                                                                                                   \
+	TEST_CASE(fmt::format("Test OUTER -- {}", STRINGIFY(SCALAR)), "[linalg]") {                    \
+		auto [m, n] = GENERATE(std::make_tuple(1, 1),                                              \
+							   std::make_tuple(7, 13),                                             \
+							   std::make_tuple(300, 5),                                            \
+							   std::make_tuple(5, 3000));                                          \
+                                                                                                   \
+		/* A column times a row, given directly or as transposed views of a row and a column */    \
+		auto col  = testMatrix<SCALAR>(m, 1, 1);                                                   \
+		auto row  = testMatrix<SCALAR>(1, n, 2);                                                   \
+		auto colT = lrc::transpose(col).eval();                                                    \
+		auto rowT = lrc::transpose(row).eval();                                                    \
+		auto c	  = lrc::dot(col, row).eval();                                                     \
+		auto cT	  = lrc::dot(lrc::transpose(colT), lrc::transpose(rowT)).eval();                   \
+		REQUIRE(c.shape() == lrc::Shape({m, n}));                                                  \
+		REQUIRE(cT.shape() == lrc::Shape({m, n}));                                                 \
+		for (int64_t i = 0; i < m; ++i) {                                                          \
+			for (int64_t j = 0; j < n; ++j) {                                                      \
+				REQUIRE(c.scalar(i * n + j) == col.scalar(i) * row.scalar(j));                     \
+				REQUIRE(cT.scalar(i * n + j) == col.scalar(i) * row.scalar(j));                    \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_DOT_AND_OUTER(int32_t)
+TEST_DOT_AND_OUTER(int64_t)
+TEST_DOT_AND_OUTER(float)
+TEST_DOT_AND_OUTER(double)
+
+#define TEST_FIXED_SIZE(SCALAR)                                                                    \
+	TEST_CASE(fmt::format("Test fixed-size GEMM -- {}", STRINGIFY(SCALAR)), "[linalg]") {          \
+		auto a		  = testFixedMatrix<SCALAR, 4, 4>(1);                                          \
+		auto b		  = testFixedMatrix<SCALAR, 4, 4>(2);                                          \
+		auto expected = [&](int64_t i, int64_t j, bool transA, bool transB) {                      \
+			SCALAR sum = 0;                                                                        \
+			for (int64_t p = 0; p < 4; ++p) {                                                      \
+				sum += a.scalar(transA ? p * 4 + i : i * 4 + p) *                                  \
+					   b.scalar(transB ? j * 4 + p : p * 4 + j);                                   \
+			}                                                                                      \
+			return sum;                                                                            \
+		};                                                                                         \
+                                                                                                   \
+		/* The product of fixed-size matrices is a fixed-size matrix */                            \
+		auto c	 = lrc::dot(a, b).eval();                                                          \
+		auto cTA = lrc::dot(lrc::transpose(a), b).eval();                                          \
+		auto cTB = lrc::dot(a, lrc::transpose(b)).eval();                                          \
+		auto cTT = lrc::dot(lrc::transpose(a), lrc::transpose(b)).eval();                          \
+		STATIC_REQUIRE(std::is_same_v<decltype(c), lrc::MatrixF<SCALAR, 4, 4>>);                   \
+		for (int64_t i = 0; i < 4; ++i) {                                                          \
+			for (int64_t j = 0; j < 4; ++j) {                                                      \
+				REQUIRE(c.scalar(i * 4 + j) == expected(i, j, false, false));                      \
+				REQUIRE(cTA.scalar(i * 4 + j) == expected(i, j, true, false));                     \
+				REQUIRE(cTB.scalar(i * 4 + j) == expected(i, j, false, true));                     \
+				REQUIRE(cTT.scalar(i * 4 + j) == expected(i, j, true, true));                      \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Other products can be assigned to a fixed-size matrix of the right size */              \
+		auto d = testFixedMatrix<SCALAR, 2, 3>(3);                                                 \
+		auto e = testFixedMatrix<SCALAR, 3, 5>(4);                                                 \
+		lrc::MatrixF<SCALAR, 2, 5> f = lrc::dot(d, e);                                             \
+		for (int64_t i = 0; i < 2; ++i) {                                                          \
+			for (int64_t j = 0; j < 5; ++j) {                                                      \
+				SCALAR sum = 0;                                                                    \
+				for (int64_t p = 0; p < 3; ++p) sum += d.scalar(i * 3 + p) * e.scalar(p * 5 + j);  \
+				REQUIRE(f.scalar(i * 5 + j) == sum);                                               \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Matrix-vector and non-square products are fixed-size too, for any transpose flags */    \
+		auto v	 = testFixedVector<SCALAR, 4>(5);                                                  \
+		auto av	 = lrc::dot(a, v).eval();                                                          \
+		auto aTv = lrc::dot(lrc::transpose(a), v).eval();                                          \
+		STATIC_REQUIRE(std::is_same_v<decltype(av), lrc::MatrixF<SCALAR, 4>>);                     \
+		for (int64_t i = 0; i < 4; ++i) {                                                          \
+			SCALAR sum = 0, sumT = 0;                                                              \
+			for (int64_t p = 0; p < 4; ++p) {                                                      \
+				sum += a.scalar(i * 4 + p) * v.scalar(p);                                          \
+				sumT += a.scalar(p * 4 + i) * v.scalar(p);                                         \
+			}                                                                                      \
+			REQUIRE(av.scalar(i) == sum);                                                          \
+			REQUIRE(aTv.scalar(i) == sumT);                                                        \
+		}                                                                                          \
+                                                                                                   \
+		auto affine = testFixedMatrix<SCALAR, 3, 4>(6);                                            \
+		auto h		= testFixedMatrix<SCALAR, 3, 3>(7);                                            \
+		auto g		= lrc::dot(affine, b).eval();                                                  \
+		auto gT		= lrc::dot(lrc::transpose(affine), h).eval();                                  \
+		STATIC_REQUIRE(std::is_same_v<decltype(g), lrc::MatrixF<SCALAR, 3, 4>>);                   \
+		STATIC_REQUIRE(std::is_same_v<decltype(gT), lrc::MatrixF<SCALAR, 4, 3>>);                  \
+		for (int64_t i = 0; i < 3; ++i) {                                                          \
+			for (int64_t j = 0; j < 4; ++j) {                                                      \
+				SCALAR sum = 0, sumT = 0;                                                          \
+				for (int64_t p = 0; p < 4; ++p) {                                                  \
+					sum += affine.scalar(i * 4 + p) * b.scalar(p * 4 + j);                         \
+				}                                                                                  \
+				for (int64_t p = 0; p < 3; ++p) {                                                  \
+					sumT += affine.scalar(p * 4 + j) * h.scalar(p * 3 + i);                        \
+				}                                                                                  \
+				REQUIRE(g.scalar(i * 4 + j) == sum);                                               \
+				REQUIRE(gT.scalar(j * 3 + i) == sumT);                                             \
+			}                                                                                      \
+		}                                                                                          \
+	}                                                                                              \
+                                                                                                   \
+	TEST_CASE(fmt::format("Test fixed-size transpose -- {}", STRINGIFY(SCALAR)), "[linalg]") {     \
+		auto a	= testFixedMatrix<SCALAR, 3, 5>(1);                                                \
+		auto aT = lrc::transpose(a).eval();                                                        \
+		STATIC_REQUIRE(std::is_same_v<decltype(aT), lrc::MatrixF<SCALAR, 5, 3>>);                  \
+		for (int64_t i = 0; i < 3; ++i) {                                                          \
+			for (int64_t j = 0; j < 5; ++j) REQUIRE(aT.scalar(j * 3 + i) == a.scalar(i * 5 + j));  \
+		}                                                                                          \
+	}                                                                                              \
+                                                                                                   \
+	TEST_CASE(fmt::format("Test fixed-size inverse -- {}", STRINGIFY(SCALAR)), "[linalg]") {       \
+		/* Small matrices use the closed-form inverse, larger ones use Gauss-Jordan elimination */ \
+		auto checkInverse = [](const auto &matrix, int64_t n) {                                    \
+			auto product = lrc::dot(matrix, lrc::inverse(matrix)).eval();                          \
+			for (int64_t i = 0; i < n; ++i) {                                                      \
+				for (int64_t j = 0; j < n; ++j) {                                                  \
+					REQUIRE(product.scalar(i * n + j) == SCALAR(i == j));                          \
+				}                                                                                  \
+			}                                                                                      \
+		};                                                                                         \
+                                                                                                   \
+		checkInverse(testInvertible<SCALAR, 2>(), 2);                                              \
+		checkInverse(testInvertible<SCALAR, 3>(), 3);                                              \
+		checkInverse(testInvertible<SCALAR, 4>(), 4);                                              \
+		checkInverse(testInvertible<SCALAR, 8>(), 8);                                              \
+	}
+
+TEST_FIXED_SIZE(float)
+TEST_FIXED_SIZE(double)
+
+#define TEST_EPILOGUE(SCALAR)                                                                      \
+	TEST_CASE(fmt::format("Test GEMM epilogue -- {}", STRINGIFY(SCALAR)), "[linalg]") {            \
+		/* The largest product is computed in many tiles, on several threads */                    \
+		auto [m, n, k] = GENERATE(std::make_tuple(1, 1, 1),                                        \
+								  std::make_tuple(7, 13, 5),                                       \
+								  std::make_tuple(1000, 600, 9));                                  \
+                                                                                                   \
+		/* A dense layer with a ReLU activation. The row is added to check the indices */          \
+		auto a		  = testMatrix<SCALAR>(m, k, 1);                                               \
+		auto b		  = testMatrix<SCALAR>(k, n, 2);                                               \
+		auto bias	  = testVector<SCALAR>(n, 3);                                                  \
+		auto epilogue = [&bias](SCALAR value, int64_t row, int64_t col) {                          \
+			return std::max(SCALAR(value + bias.scalar(col)), SCALAR(0)) + SCALAR(row % 3);        \
+		};                                                                                         \
+                                                                                                   \
+		auto product = lrc::dot(a, b).eval();                                                      \
+		auto aT		 = lrc::transpose(a).eval();                                                   \
+		auto cT		 = lrc::dot(lrc::transpose(aT), b).withEpilogue(epilogue).eval();              \
+                                                                                                   \
+		/* Assigning to an array applies the epilogue in the same way */                           \
+		lrc::Array<SCALAR, CPU> c = lrc::dot(a, b).withEpilogue(epilogue);                         \
+		REQUIRE(c.shape() == lrc::Shape({m, n}));                                                  \
+		REQUIRE(cT.shape() == lrc::Shape({m, n}));                                                 \
+		for (int64_t i = 0; i < m; ++i) {                                                          \
+			for (int64_t j = 0; j < n; ++j) {                                                      \
+				REQUIRE(c.scalar(i * n + j) == epilogue(product.scalar(i * n + j), i, j));         \
+				REQUIRE(cT.scalar(i * n + j) == epilogue(product.scalar(i * n + j), i, j));        \
+			}                                                                                      \
+		}                                                                                          \
+	}                                                                                              \
+                                                                                                   \
+	TEST_CASE(fmt::format("Test GEMM packet epilogue -- {}", STRINGIFY(SCALAR)), "[linalg]") {     \
+		auto [m, n, k] = GENERATE(std::make_tuple(7, 13, 5), std::make_tuple(300, 200, 9));        \
+                                                                                                   \
+		auto a = testMatrix<SCALAR>(m, k, 1);                                                      \
+		auto b = testMatrix<SCALAR>(k, n, 2);                                                      \
+		std::atomic<int64_t> packets = 0;                                                          \
+		PacketEpilogue<SCALAR> epilogue {&packets};                                                \
+                                                                                                   \
+		auto product = lrc::dot(a, b).eval();                                                      \
+		auto c		 = lrc::dot(a, b).withEpilogue(epilogue).eval();                               \
+		for (int64_t i = 0; i < m; ++i) {                                                          \
+			for (int64_t j = 0; j < n; ++j) {                                                      \
+				REQUIRE(c.scalar(i * n + j) == epilogue(product.scalar(i * n + j), i, j));         \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* The packet form is used wherever a whole packet of a row is available */                \
+		constexpr bool vectorised =                                                                \
+		  lrc::typetraits::IsPacketEpilogue<PacketEpilogue<SCALAR>, SCALAR>::value;                \
+		constexpr int64_t width = lrc::typetraits::TypeInfo<SCALAR>::packetWidth;                  \
+		REQUIRE((packets > 0) == (vectorised && n >= width));                                      \
+	}                                                                                              \
+                                                                                                   \
+	TEST_CASE(fmt::format("Test DOT epilogue -- {}", STRINGIFY(SCALAR)), "[linalg]") {             \
+		auto a		  = testVector<SCALAR>(100, 1);                                                \
+		auto b		  = testVector<SCALAR>(100, 2);                                                \
+		auto epilogue = [](SCALAR value, int64_t, int64_t) { return value * 2 + 1; };              \
+                                                                                                   \
+		auto c = lrc::dot(a, b).withEpilogue(epilogue).eval();                                     \
+		REQUIRE(c.shape() == lrc::Shape({1}));                                                     \
+		REQUIRE(c.scalar(0) == epilogue(lrc::dot(a, b).eval().scalar(0), 0, 0));                   \
+	}                                                                                              \
+
+TEST_EPILOGUE(int32_t)
+TEST_EPILOGUE(float)
+TEST_EPILOGUE(double)
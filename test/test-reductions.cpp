@@ -0,0 +1,97 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc			   = librapid;
+constexpr double tolerance = 0.001;
+using CPU				   = lrc::backend::CPU;
+
+#define TEST_REDUCTIONS(SCALAR)                                                                    \
+	TEST_CASE(fmt::format("Test Array Reductions -- {}", STRINGIFY(SCALAR)), "[array-lib]") {     \
+		SECTION("Full reductions") {                                                               \
+			/* Large enough to use the parallel path, and not a multiple of the packet width */    \
+			auto a = lrc::ordered<SCALAR, CPU>({10007});                                           \
+                                                                                                   \
+			double expectedSum = 0;                                                                \
+			for (int64_t i = 0; i < 10007; ++i) expectedSum += double(SCALAR(i));                 \
+                                                                                                   \
+			REQUIRE(lrc::isClose(double(lrc::sum(a)), expectedSum, tolerance * expectedSum));     \
+			REQUIRE(lrc::amin(a) == SCALAR(0));                                                    \
+			REQUIRE(lrc::amax(a) == SCALAR(10006));                                                \
+			REQUIRE(lrc::argmax(a) == 10006);                                                      \
+			REQUIRE(lrc::argmin(a) == 0);                                                          \
+                                                                                                   \
+			auto b = lrc::ones<SCALAR, CPU>({5});                                                  \
+			REQUIRE(lrc::prod(b + b) == SCALAR(32));                                               \
+			REQUIRE(lrc::mean(b * SCALAR(3)) == SCALAR(3));                                        \
+		}                                                                                          \
+                                                                                                   \
+		SECTION("Lazy expressions") {                                                              \
+			auto a = lrc::ordered<SCALAR, CPU>({37, 41});                                          \
+			auto b = lrc::ones<SCALAR, CPU>({37, 41});                                             \
+                                                                                                   \
+			SCALAR expected = 0;                                                                   \
+			for (int64_t i = 0; i < 37 * 41; ++i) expected += a.scalar(i) * SCALAR(2) + SCALAR(1); \
+                                                                                                   \
+			REQUIRE(lrc::isClose(lrc::sum(a * (b + b) + b), expected, tolerance));                \
+			REQUIRE(lrc::argmax(SCALAR(0) - a) == 0);                                              \
+		}                                                                                          \
+                                                                                                   \
+		SECTION("Axis reductions") {                                                               \
+			auto a = lrc::ordered<SCALAR, CPU>({3, 37, 41});                                       \
+                                                                                                   \
+			auto sum0 = lrc::sum(a, 0);                                                            \
+			REQUIRE(sum0.shape() == lrc::Shape({37, 41}));                                         \
+			for (int64_t i = 0; i < 37 * 41; ++i) {                                                \
+				SCALAR expected = a.scalar(i) + a.scalar(i + 37 * 41) + a.scalar(i + 2 * 37 * 41); \
+				REQUIRE(lrc::isClose(sum0.scalar(i), expected, tolerance));                        \
+			}                                                                                      \
+                                                                                                   \
+			auto max2 = lrc::amax(a, -1);                                                          \
+			REQUIRE(max2.shape() == lrc::Shape({3, 37}));                                          \
+			for (int64_t i = 0; i < 3 * 37; ++i) {                                                 \
+				REQUIRE(max2.scalar(i) == a.scalar(i * 41 + 40));                                  \
+			}                                                                                      \
+                                                                                                   \
+			auto min1 = lrc::amin(a, 1);                                                           \
+			REQUIRE(min1.shape() == lrc::Shape({3, 41}));                                          \
+			for (int64_t i = 0; i < 3; ++i) {                                                      \
+				for (int64_t j = 0; j < 41; ++j) {                                                 \
+					REQUIRE(min1.scalar(i * 41 + j) == a.scalar(i * 37 * 41 + j));                 \
+				}                                                                                  \
+			}                                                                                      \
+                                                                                                   \
+			auto sum12 = lrc::sum(a, {1, 2});                                                      \
+			auto sum02 = lrc::sum(a, {0, 2});                                                      \
+			REQUIRE(sum12.shape() == lrc::Shape({3}));                                             \
+			REQUIRE(sum02.shape() == lrc::Shape({37}));                                            \
+			for (int64_t i = 0; i < 3; ++i) {                                                      \
+				SCALAR expected = 0;                                                               \
+				for (int64_t j = 0; j < 37 * 41; ++j) expected += a.scalar(i * 37 * 41 + j);       \
+				REQUIRE(lrc::isClose(sum12.scalar(i), expected, tolerance));                       \
+			}                                                                                      \
+			for (int64_t j = 0; j < 37; ++j) {                                                     \
+				SCALAR expected = 0;                                                               \
+				for (int64_t i = 0; i < 3; ++i) {                                                  \
+					for (int64_t k = 0; k < 41; ++k) {                                             \
+						expected += a.scalar(i * 37 * 41 + j * 41 + k);                            \
+					}                                                                              \
+				}                                                                                  \
+				REQUIRE(lrc::isClose(sum02.scalar(j), expected, tolerance));                       \
+			}                                                                                      \
+                                                                                                   \
+			auto arg1 = lrc::argmax(a, 1);                                                         \
+			REQUIRE(arg1.shape() == lrc::Shape({3, 41}));                                          \
+			for (int64_t i = 0; i < 3 * 41; ++i) REQUIRE(arg1.scalar(i) == 36);                    \
+                                                                                                   \
+			auto mean0 = lrc::mean(a, 0);                                                          \
+			for (int64_t i = 0; i < 37 * 41; ++i) {                                                \
+				REQUIRE(lrc::isClose(mean0.scalar(i), a.scalar(i + 37 * 41), tolerance));          \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_REDUCTIONS(float)
+TEST_REDUCTIONS(double)
+TEST_REDUCTIONS(int32_t)
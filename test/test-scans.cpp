@@ -0,0 +1,70 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc			   = librapid;
+constexpr double tolerance = 0.001;
+using CPU				   = lrc::backend::CPU;
+
+#define TEST_SCANS(SCALAR)                                                                         \
+	TEST_CASE(fmt::format("Test Array Scans -- {}", STRINGIFY(SCALAR)), "[array-lib]") {           \
+		SECTION("Flattened scans") {                                                               \
+			/* Large enough to use the parallel path, and not a multiple of the packet width */    \
+			auto a = lrc::ordered<SCALAR, CPU>({10007});                                           \
+			auto b = lrc::ones<SCALAR, CPU>({10007});                                              \
+                                                                                                   \
+			auto sum = lrc::cumsum(a);                                                             \
+			auto max = lrc::cummax(SCALAR(0) - a);                                                 \
+			auto min = lrc::cummin(a * b);                                                         \
+			REQUIRE(sum.shape() == lrc::Shape({10007}));                                           \
+			double expected = 0;                                                                   \
+			for (int64_t i = 0; i < 10007; ++i) {                                                  \
+				expected += double(SCALAR(i));                                                     \
+				const double margin = tolerance * (expected + 1);                                  \
+				REQUIRE(lrc::isClose(double(sum.scalar(i)), expected, margin));                    \
+				REQUIRE(max.scalar(i) == SCALAR(0));                                               \
+				REQUIRE(min.scalar(i) == SCALAR(0));                                               \
+			}                                                                                      \
+                                                                                                   \
+			auto c    = lrc::ones<SCALAR, CPU>({2, 3}) * SCALAR(2);                                \
+			auto prod = lrc::cumprod(c);                                                           \
+			REQUIRE(prod.shape() == lrc::Shape({6}));                                              \
+			for (int64_t i = 0; i < 6; ++i) REQUIRE(prod.scalar(i) == SCALAR(2 << i));             \
+		}                                                                                          \
+                                                                                                   \
+		SECTION("Axis scans") {                                                                    \
+			auto a = lrc::ordered<SCALAR, CPU>({3, 37, 41});                                       \
+                                                                                                   \
+			auto sum2 = lrc::cumsum(a, -1);                                                        \
+			auto sum1 = lrc::cumsum(a, 1);                                                         \
+			auto max0 = lrc::cummax(SCALAR(0) - a, 0);                                             \
+			REQUIRE(sum2.shape() == a.shape());                                                    \
+			REQUIRE(sum1.shape() == a.shape());                                                    \
+			REQUIRE(max0.shape() == a.shape());                                                    \
+                                                                                                   \
+			for (int64_t i = 0; i < 3; ++i) {                                                      \
+				for (int64_t k = 0; k < 41; ++k) {                                                 \
+					SCALAR expected = 0;                                                           \
+					for (int64_t j = 0; j < 37; ++j) {                                             \
+						const int64_t index = i * 37 * 41 + j * 41 + k;                            \
+						expected += a.scalar(index);                                               \
+						REQUIRE(lrc::isClose(sum1.scalar(index), expected, tolerance));            \
+						REQUIRE(max0.scalar(index) == SCALAR(0) - a.scalar(j * 41 + k));           \
+					}                                                                              \
+				}                                                                                  \
+			}                                                                                      \
+                                                                                                   \
+			for (int64_t row = 0; row < 3 * 37; ++row) {                                           \
+				SCALAR expected = 0;                                                               \
+				for (int64_t k = 0; k < 41; ++k) {                                                 \
+					expected += a.scalar(row * 41 + k);                                            \
+					REQUIRE(lrc::isClose(sum2.scalar(row * 41 + k), expected, tolerance));         \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+TEST_SCANS(float)
+TEST_SCANS(double)
+TEST_SCANS(int32_t)
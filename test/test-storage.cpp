@@ -205,6 +205,272 @@ TEST_CASE("Test Storage<T>", "[storage]") {
         REQUIRE(storage5[1].c == 6);
     }
 
+    SECTION("Huge Page Allocations") {
+        lrc::global::ScopedSetting threshold(lrc::global::hugePageThreshold, size_t(1024 * 1024));
+        lrc::trimAllocationCache();
+        lrc::resetAllocationStats();
+
+        const auto before = lrc::allocationStats();
+        {
+            lrc::Storage<float> small(1000, 1.0f);
+            lrc::Storage<float> large(1000000, 2.0f);
+            REQUIRE(small[999] == 1.0f);
+            REQUIRE(large[0] == 2.0f);
+            REQUIRE(large[999999] == 2.0f);
+
+            const auto during = lrc::allocationStats();
+            REQUIRE(during.allocations == 2);
+            REQUIRE(during.bytesInUse >= before.bytesInUse + 1001000 * sizeof(float));
+            REQUIRE(during.peakBytesInUse >= during.bytesInUse);
+
+#if defined(LIBRAPID_LINUX)
+            REQUIRE(during.hugePageAllocations == 1);
+            REQUIRE(during.hugePageBytesInUse >= 1000000 * sizeof(float));
+            REQUIRE(reinterpret_cast<uintptr_t>(large.begin()) % lrc::detail::hugePageSize == 0);
+#endif
+
+            // Changing the threshold must not affect how existing blocks are freed
+            lrc::global::hugePageThreshold = SIZE_MAX;
+        }
+
+        // Freed blocks are cached, so release them before checking the mappings are gone
+        lrc::trimAllocationCache();
+
+        const auto after = lrc::allocationStats();
+        REQUIRE(after.deallocations == 2);
+        REQUIRE(after.bytesInUse == before.bytesInUse);
+        REQUIRE(after.hugePageBytesInUse == before.hugePageBytesInUse);
+    }
+
+    SECTION("Allocation Cache") {
+        lrc::trimAllocationCache();
+        lrc::resetAllocationStats();
+
+        // A freed block is reused by the next allocation of a similar size
+        const float *first;
+        {
+            lrc::Storage<float> storage(100000);
+            first = storage.begin();
+        }
+        REQUIRE(lrc::allocationStats().cachedBytes >= 100000 * sizeof(float));
+        {
+            lrc::Storage<float> storage(99000);
+            REQUIRE(storage.begin() == first);
+            REQUIRE(lrc::allocationStats().cacheHits == 1);
+        }
+
+        // Nothing is cached beyond the limit
+        {
+            lrc::global::ScopedSetting limit(lrc::global::allocationCacheLimit, size_t(0));
+            { lrc::Storage<double> storage(100000); }
+            REQUIRE(lrc::allocationStats().cachedBytes == 0);
+        }
+
+        // Trimming releases everything
+        { lrc::Storage<double> storage(100000); }
+        REQUIRE(lrc::allocationStats().cachedBytes > 0);
+        lrc::trimAllocationCache();
+        REQUIRE(lrc::allocationStats().cachedBytes == 0);
+    }
+
+    SECTION("Capacity") {
+        lrc::Storage<int> storage(100);
+        for (int i = 0; i < 100; ++i) storage[i] = i;
+        REQUIRE(storage.capacity() == 100);
+
+        // Shrinking happens in place
+        const int *begin = storage.begin();
+        storage.resize(60);
+        REQUIRE(storage.size() == 60);
+        REQUIRE(storage.capacity() == 100);
+        REQUIRE(storage.begin() == begin);
+
+        // ... and so does growing again, within the capacity
+        storage.resize(90);
+        REQUIRE(storage.size() == 90);
+        REQUIRE(storage.begin() == begin);
+        for (int i = 0; i < 60; ++i) REQUIRE(storage[i] == i);
+
+        storage.reserve(1000);
+        REQUIRE(storage.size() == 90);
+        REQUIRE(storage.capacity() == 1000);
+        for (int i = 0; i < 60; ++i) REQUIRE(storage[i] == i);
+
+        storage.shrinkToFit();
+        REQUIRE(storage.capacity() == 90);
+        for (int i = 0; i < 60; ++i) REQUIRE(storage[i] == i);
+
+        // Discarding resizes reuse the memory unless most of it would be wasted
+        begin = storage.begin();
+        storage.resize(80, 0);
+        REQUIRE(storage.begin() == begin);
+        REQUIRE(storage.capacity() == 90);
+        storage.resize(10, 0);
+        REQUIRE(storage.size() == 10);
+        REQUIRE(storage.capacity() == std::max<size_t>(10, lrc::Storage<int>::inlineCapacity));
+
+        // Copying elements (which are stored inline, so cannot be shared) into a larger Storage
+        // object reuses its memory if at least half of it is used, and otherwise releases it
+        lrc::Storage<int> medium(30, 2);
+        lrc::Storage<int> large(50, 1);
+        begin = large.begin();
+        large = medium;
+        REQUIRE(large.size() == 30);
+        if (lrc::Storage<int>::inlineCapacity >= 30) REQUIRE(large.begin() == begin);
+        REQUIRE(large[29] == 2);
+
+        lrc::Storage<int> small(5, 3);
+        large = small;
+        REQUIRE(large.size() == 5);
+        REQUIRE(large.begin() != begin);
+        REQUIRE(large[4] == 3);
+
+#if defined(LIBRAPID_LINUX)
+        // Huge page buffers are resized without copying
+        lrc::global::ScopedSetting threshold(lrc::global::hugePageThreshold, size_t(1024 * 1024));
+
+        lrc::Storage<float> huge(1000000);
+        for (size_t i = 0; i < huge.size(); ++i) huge[i] = float(i);
+        huge.resize(3000000);
+        REQUIRE(huge.capacity() == 3000000);
+        REQUIRE(reinterpret_cast<uintptr_t>(huge.begin()) % lrc::detail::hugePageSize == 0);
+        for (size_t i = 0; i < 1000000; ++i) REQUIRE(huge[i] == float(i));
+#endif
+    }
+
+    SECTION("Inline Storage") {
+        constexpr size_t inlineCapacity = lrc::Storage<float>::inlineCapacity;
+        REQUIRE(inlineCapacity == LIBRAPID_STORAGE_INLINE_BYTES / sizeof(float));
+        REQUIRE(lrc::Storage<std::string>::inlineCapacity == 0);
+
+        // Small arrays do not touch the allocator
+        lrc::resetAllocationStats();
+        lrc::Storage<float> storage(8, 1.5f);
+        REQUIRE(storage.capacity() == inlineCapacity);
+        REQUIRE(lrc::allocationStats().allocations == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(storage.begin()) % LIBRAPID_MEM_ALIGN == 0);
+
+        // The data is copied when the object is moved
+        lrc::Storage<float> moved = std::move(storage);
+        REQUIRE(moved.size() == 8);
+        REQUIRE(moved[7] == 1.5f);
+
+        lrc::Storage<float> copied(moved);
+        moved[0] = 2.5f;
+        REQUIRE(copied[0] == 1.5f);
+
+        // Growing past the inline buffer moves the data to the heap ...
+        copied.resize(inlineCapacity + 1);
+        REQUIRE(lrc::allocationStats().allocations == 1);
+        for (size_t i = 0; i < 8; ++i) REQUIRE(copied[i] == 1.5f);
+
+        // ... and shrinking it again brings it back
+        copied.resize(4);
+        copied.shrinkToFit();
+        REQUIRE(copied.capacity() == inlineCapacity);
+        REQUIRE(lrc::allocationStats().deallocations == 1);
+        for (size_t i = 0; i < 4; ++i) REQUIRE(copied[i] == 1.5f);
+    }
+
+    SECTION("Copy-On-Write") {
+        lrc::Storage<double> storage(1000, 1.0);
+        const auto &constStorage = storage;
+
+        // Copies share the data until one of them is modified
+        lrc::Storage<double> copy(storage);
+        const auto &constCopy = copy;
+        REQUIRE(copy.isShared());
+        REQUIRE(constCopy.begin() == constStorage.begin());
+
+        copy[0] = 2.0;
+        REQUIRE(!copy.isShared());
+        REQUIRE(!storage.isShared());
+        REQUIRE(constCopy.begin() != constStorage.begin());
+        REQUIRE(storage[0] == 1.0);
+        REQUIRE(copy[0] == 2.0);
+
+        // Assignment shares the data too
+        copy = storage;
+        REQUIRE(constCopy.begin() == constStorage.begin());
+        storage[1] = 3.0;
+        REQUIRE(copy[1] == 1.0);
+
+        // Elements which are about to be overwritten are not copied, even if they are shared
+        lrc::Storage<double> overwritten(storage);
+        overwritten.resizeForOverwrite(storage.size());
+        REQUIRE(!overwritten.isShared());
+        REQUIRE(std::as_const(overwritten).begin() != constStorage.begin());
+        REQUIRE(overwritten.size() == storage.size());
+        REQUIRE(storage[1] == 3.0);
+
+        // Views write to the original data, and keep it alive
+        auto owner                     = std::make_unique<lrc::Storage<double>>(1000, 4.0);
+        lrc::Storage<double> ownerCopy = *owner;
+        lrc::Storage<double> view      = owner->view(100, 10);
+        REQUIRE(view.size() == 10);
+
+        view[0] = 5.0;
+        REQUIRE((*owner)[100] == 5.0);
+        REQUIRE(ownerCopy[100] == 4.0);
+
+        owner.reset();
+        REQUIRE(view[0] == 5.0);
+        REQUIRE(view[9] == 4.0);
+
+        // Assigning a view to an owning Storage object copies the elements
+        lrc::Storage<double> values(3, 0.0);
+        values = view;
+        values[0] = 6.0;
+        REQUIRE(values.size() == 10);
+        REQUIRE(view[0] == 5.0);
+    }
+
+    SECTION("Views") {
+        lrc::Storage<double> owner(1000, 1.0);
+        lrc::Storage<double> view = owner.view(100, 10);
+
+        // Writes through either object are seen by the other
+        view[0]    = 2.0;
+        owner[101] = 3.0;
+        REQUIRE(owner[100] == 2.0);
+        REQUIRE(view[1] == 3.0);
+
+        // Copies of the owner and of the view have elements of their own
+        lrc::Storage<double> ownerCopy(owner);
+        lrc::Storage<double> viewCopy(view);
+        REQUIRE(!ownerCopy.isShared());
+        REQUIRE(std::as_const(ownerCopy).begin() != std::as_const(owner).begin());
+        ownerCopy[100] = 4.0;
+        viewCopy[0]    = 5.0;
+        REQUIRE(owner[100] == 2.0);
+        REQUIRE(view[0] == 2.0);
+
+        // Copying into the owner writes into the viewed elements if the size is unchanged
+        lrc::Storage<double> sixes(1000, 6.0);
+        owner = sixes;
+        REQUIRE(view[0] == 6.0);
+
+        // Moving the view transfers the reference to the elements
+        lrc::Storage<double> moved(3, 0.0);
+        moved    = std::move(view);
+        moved[2] = 7.0;
+        REQUIRE(moved.size() == 10);
+        REQUIRE(owner[102] == 7.0);
+
+        // Once the owner is reallocated, the view keeps the old elements
+        owner.resize(100000);
+        moved[3] = 8.0;
+        REQUIRE(owner[103] == 6.0);
+        REQUIRE(moved[3] == 8.0);
+
+        // Inline elements are moved to the heap, so the view stays valid if the owner moves
+        lrc::Storage<float> small(4, 1.0f);
+        lrc::Storage<float> smallView  = small.view(1, 2);
+        lrc::Storage<float> smallMoved = std::move(small);
+        smallView[0]                   = 2.0f;
+        REQUIRE(smallMoved[1] == 2.0f);
+    }
+
     SECTION("Benchmarks") {
         BENCHMARK_CONSTRUCTORS(int, 123);
         BENCHMARK_CONSTRUCTORS(double, 456);
@@ -0,0 +1,80 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test parallelFor", "[thread-pool]") {
+	SECTION("Every index is visited exactly once") {
+		constexpr int64_t n = 100003;
+		std::vector<std::atomic<int>> visits(n);
+
+		lrc::parallelFor(0, n, [&](int64_t i) { visits[i].fetch_add(1); });
+		for (int64_t i = 0; i < n; ++i) REQUIRE(visits[i].load() == 1);
+
+		// Offset ranges, and ranges smaller than a single chunk
+		lrc::parallelFor(10, 20, [&](int64_t i) { visits[i].fetch_add(1); });
+		lrc::parallelFor(5, 5, [&](int64_t i) { visits[i].fetch_add(1); });
+		for (int64_t i = 0; i < 30; ++i) {
+			REQUIRE(visits[i].load() == (i >= 10 && i < 20 ? 2 : 1));
+		}
+	}
+
+	SECTION("Chunks respect the grain size") {
+		constexpr int64_t n		= 100000;
+		constexpr int64_t grain = 16;
+		std::atomic<int64_t> total = 0;
+		std::atomic<bool> aligned  = true;
+
+		lrc::parallelFor(
+		  3,
+		  n,
+		  [&](int64_t first, int64_t last) {
+			  if ((first - 3) % grain != 0 || (last != n && (last - 3) % grain != 0)) {
+				  aligned = false;
+			  }
+			  total += last - first;
+		  },
+		  grain);
+
+		REQUIRE(aligned.load());
+		REQUIRE(total.load() == n - 3);
+	}
+
+	SECTION("Nested loops run serially") {
+		std::atomic<int64_t> total = 0;
+		lrc::parallelFor(0, 64, [&](int64_t) {
+			lrc::parallelFor(0, 1000, [&](int64_t first, int64_t last) { total += last - first; });
+		});
+		REQUIRE(total.load() == 64 * 1000);
+	}
+
+	SECTION("Exceptions are rethrown on the calling thread") {
+		REQUIRE_THROWS_AS(lrc::parallelFor(0,
+										   100000,
+										   [](int64_t i) {
+											   if (i == 54321) throw std::runtime_error("Error");
+										   }),
+						  std::runtime_error);
+
+		// The pool is still usable afterwards
+		std::atomic<int64_t> total = 0;
+		lrc::parallelFor(0, 100000, [&](int64_t) { ++total; });
+		REQUIRE(total.load() == 100000);
+	}
+
+	SECTION("Pinned workers and first-touch allocation") {
+		lrc::global::ScopedSetting pin(lrc::global::pinThreads, true);
+		lrc::global::ScopedSetting touch(lrc::global::numaFirstTouch, true);
+		lrc::global::ScopedSetting minimum(lrc::global::numaFirstTouchThreshold, size_t(0));
+
+		std::atomic<int64_t> total = 0;
+		lrc::parallelFor(0, 100000, [&](int64_t) { ++total; });
+		REQUIRE(total.load() == 100000);
+
+		auto a = lrc::ordered<float, lrc::backend::CPU>({250000});
+		lrc::Array<float, lrc::backend::CPU> b = a + a;
+		for (int64_t i = 0; i < 250000; ++i) REQUIRE(b.scalar(i) == float(i) * 2.0f);
+	}
+}